@@ -0,0 +1,74 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <time.h>
+
+#define BENCHMARK_RESULT_FAIL 1
+#define BENCHMARK_RESULT_SKIP 77
+
+#define BENCHMARK_REPETITIONS 5
+
+#define BENCHMARK_PRINT(stream, ...)                                           \
+  do {                                                                         \
+    (void) fprintf(stream, __VA_ARGS__);                                       \
+    (void) fflush(stream);                                                     \
+  } while(0)
+
+#define BENCHMARK_FAIL(...)                                                    \
+  do {                                                                         \
+    BENCHMARK_PRINT(stderr, "%s:%d [ERROR] Benchmark failed because ",         \
+      __FILE__, __LINE__);                                                     \
+    BENCHMARK_PRINT(stderr, __VA_ARGS__);                                      \
+    BENCHMARK_PRINT(stderr, ".\n");                                            \
+    return BENCHMARK_RESULT_FAIL;                                              \
+  } while(0)
+
+#define BENCHMARK_SKIP(reason)                                                 \
+  do {                                                                         \
+    BENCHMARK_PRINT(                                                           \
+      stderr,                                                                  \
+      "%s:%d [WARNING] Benchmark skipped because"                              \
+          " " reason ".\n",                                                    \
+      __FILE__,                                                                \
+      __LINE__                                                                 \
+    );                                                                         \
+    return BENCHMARK_RESULT_SKIP;                                              \
+  } while(0)
+
+#define BENCHMARK_PRINT_HEADER()                                               \
+  BENCHMARK_PRINT(stdout, "%-24s %10s %12s %12s\n",                            \
+    "case", "bytes", "items", "ns/item")
+
+/* Runs `statement` several times and prints the best time per item */
+#define BENCHMARK_RUN(name, bytes, items, statement)                           \
+  do {                                                                         \
+    double _best = -1.0;                                                       \
+    for (int _run = 0; _run < BENCHMARK_REPETITIONS; _run++) {                 \
+      struct timespec _start, _end;                                            \
+      (void) clock_gettime(CLOCK_MONOTONIC, &_start);                          \
+      statement;                                                               \
+      (void) clock_gettime(CLOCK_MONOTONIC, &_end);                            \
+      const double _elapsed = (_end.tv_sec - _start.tv_sec) * 1e9              \
+        + (_end.tv_nsec - _start.tv_nsec);                                     \
+      if (_best < 0.0 || _elapsed < _best) {                                   \
+        _best = _elapsed;                                                      \
+      }                                                                        \
+    }                                                                          \
+    BENCHMARK_PRINT(stdout, "%-24s %10zu %12zu %12.3f\n",                      \
+      (name), (size_t) (bytes), (size_t) (items), _best / (double) (items));   \
+  } while(0)
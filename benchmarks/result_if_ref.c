@@ -0,0 +1,84 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <result.h>
+#include "benchmark.h"
+
+#define ARENA_BYTES (1 << 22)
+#define PASSES 8
+
+#define DEFINE_PAYLOAD(size)                                                   \
+  typedef struct { unsigned char bytes[size]; } payload_ ## size;              \
+  RESULT_STRUCT(payload_ ## size, int);                                        \
+  static unsigned long checksum_ ## size = 0;                                  \
+  static void consume_value_ ## size(payload_ ## size payload) {               \
+    checksum_ ## size += payload.bytes[0] + payload.bytes[size - 1];           \
+  }                                                                            \
+  static void consume_ref_ ## size(const payload_ ## size *payload) {          \
+    checksum_ ## size += payload->bytes[0] + payload->bytes[size - 1];         \
+  }                                                                            \
+  /* Called through volatile pointers so that arguments cannot be elided */    \
+  static void (*volatile by_value_ ## size)(payload_ ## size) =                \
+    consume_value_ ## size;                                                    \
+  static void (*volatile by_ref_ ## size)(const payload_ ## size *) =          \
+    consume_ref_ ## size;
+
+#define BENCHMARK_PAYLOAD(size)                                                \
+  do {                                                                         \
+    typedef RESULT(payload_ ## size, int) result_type;                         \
+    const size_t count = ARENA_BYTES / sizeof(result_type);                    \
+    result_type *results = malloc(count * sizeof(result_type));                \
+    if (results == NULL) {                                                     \
+      BENCHMARK_SKIP("out of memory");                                         \
+    }                                                                          \
+    for (size_t index = 0; index < count; index++) {                           \
+      payload_ ## size payload = {{(unsigned char) index}};                    \
+      results[index] = (result_type) RESULT_SUCCESS(payload);                  \
+    }                                                                          \
+    BENCHMARK_RUN("by value " #size " B", sizeof(result_type), count * PASSES, \
+      for (int pass = 0; pass < PASSES; pass++)                                \
+        for (size_t index = 0; index < count; index++)                         \
+          RESULT_IF_SUCCESS(results[index], by_value_ ## size));               \
+    const unsigned long by_value = checksum_ ## size;                          \
+    checksum_ ## size = 0;                                                     \
+    BENCHMARK_RUN("by reference " #size " B", sizeof(result_type),             \
+      count * PASSES,                                                          \
+      for (int pass = 0; pass < PASSES; pass++)                                \
+        for (size_t index = 0; index < count; index++)                         \
+          RESULT_IF_SUCCESS_REF(results[index], by_ref_ ## size));             \
+    free(results);                                                             \
+    if (checksum_ ## size != by_value) {                                       \
+      BENCHMARK_FAIL("checksums differ for %d-byte payloads", size);           \
+    }                                                                          \
+  } while(0)
+
+DEFINE_PAYLOAD(8)
+DEFINE_PAYLOAD(64)
+DEFINE_PAYLOAD(512)
+DEFINE_PAYLOAD(4096)
+
+/**
+ * Benchmarks copying versus non-copying conditional actions.
+ */
+int main() {
+    BENCHMARK_PRINT_HEADER();
+    BENCHMARK_PAYLOAD(8);
+    BENCHMARK_PAYLOAD(64);
+    BENCHMARK_PAYLOAD(512);
+    BENCHMARK_PAYLOAD(4096);
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <result_io.h>
+#include "benchmark.h"
+
+#define COUNT 100000
+#define BYTES 64
+
+/**
+ * Benchmarks result-returning I/O wrappers versus the raw system calls.
+ */
+int main() {
+    char buffer[BYTES];
+    long long raw = 0;
+    long long wrapped = 0;
+    const int descriptor = open("/dev/zero", O_RDONLY);
+    if (descriptor == -1) {
+        BENCHMARK_SKIP("/dev/zero cannot be opened");
+    }
+    BENCHMARK_PRINT_HEADER();
+    BENCHMARK_RUN("raw pread", BYTES, COUNT,
+        for (int index = 0; index < COUNT; index++)
+            raw += pread(descriptor, buffer, BYTES, 0));
+    BENCHMARK_RUN("io_pread", BYTES, COUNT,
+        for (int index = 0; index < COUNT; index++) {
+            const RESULT(ssize_t, io_error) result =
+                io_pread(descriptor, buffer, BYTES, 0);
+            wrapped += RESULT_OR_ELSE(result, -1);
+        });
+    (void) close(descriptor);
+    if (raw != wrapped) {
+        BENCHMARK_FAIL("byte counts differ");
+    }
+    return EXIT_SUCCESS;
+}
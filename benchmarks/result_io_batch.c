@@ -0,0 +1,81 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <result_uring.h>
+#include "benchmark.h"
+
+#define OPERATIONS 4096
+#define BYTES 64
+
+static char buffers[OPERATIONS][BYTES];
+
+/* Runs a batch of reads through the supplied batch mode */
+#define BENCHMARK_BATCH(name, mode)                                            \
+  do {                                                                         \
+    struct io_batch batch;                                                     \
+    if (RESULT_HAS_FAILURE(io_batch_init(&batch, OPERATIONS, mode))) {         \
+      BENCHMARK_FAIL("%s batch cannot be initialized", name);                  \
+    }                                                                          \
+    long long total = 0;                                                       \
+    BENCHMARK_RUN(name, BYTES, OPERATIONS, {                                   \
+      for (int index = 0; index < OPERATIONS; index++)                         \
+        (void) io_batch_pread(&batch, descriptor, buffers[index], BYTES,       \
+          (off_t) index * BYTES);                                              \
+      (void) io_batch_submit(&batch);                                          \
+      for (int index = 0; index < OPERATIONS; index++) {                       \
+        const RESULT(ssize_t, io_error) result =                               \
+          io_batch_result(&batch, index);                                      \
+        total += RESULT_OR_ELSE(result, -1);                                   \
+      }                                                                        \
+    });                                                                        \
+    io_batch_destroy(&batch);                                                  \
+    if (total != expected) {                                                   \
+      BENCHMARK_FAIL("%s batch read %lld bytes", name, total);                 \
+    }                                                                          \
+  } while(0)
+
+/**
+ * Benchmarks batched reads versus one system call per read.
+ */
+int main() {
+    char path[] = "/tmp/result_io_batch_XXXXXX";
+    const int descriptor = mkstemp(path);
+    const long long expected = (long long) OPERATIONS * BYTES
+        * BENCHMARK_REPETITIONS;
+    long long total = 0;
+    if (descriptor == -1) {
+        BENCHMARK_SKIP("a temporary file cannot be created");
+    }
+    (void) unlink(path);
+    if (RESULT_HAS_FAILURE(io_write(descriptor, buffers, sizeof(buffers)))) {
+        BENCHMARK_FAIL("the temporary file cannot be written");
+    }
+    BENCHMARK_PRINT_HEADER();
+    BENCHMARK_RUN("io_pread", BYTES, OPERATIONS,
+        for (int index = 0; index < OPERATIONS; index++) {
+            const RESULT(ssize_t, io_error) result = io_pread(descriptor,
+                buffers[index], BYTES, (off_t) index * BYTES);
+            total += RESULT_OR_ELSE(result, -1);
+        });
+    if (total != expected) {
+        BENCHMARK_FAIL("io_pread read %lld bytes", total);
+    }
+    BENCHMARK_BATCH("io_batch auto", IO_BATCH_AUTO);
+    BENCHMARK_BATCH("io_batch threads", IO_BATCH_THREADS);
+    (void) close(descriptor);
+    return EXIT_SUCCESS;
+}
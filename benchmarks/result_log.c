@@ -0,0 +1,67 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdlib.h>
+#include <result_log.h>
+#include "benchmark.h"
+
+#define CAPACITY 4096
+#define COUNT (1 << 20)
+
+static struct result_log_record ring[CAPACITY];
+static uint64_t head;
+
+/**
+ * Benchmarks appending failures to a log versus formatting them via fprintf.
+ */
+int main() {
+    char path[] = "/tmp/result_log_XXXXXX";
+    const int descriptor = mkstemp(path);
+    FILE *stream = fopen("/dev/null", "w");
+    struct result_log log;
+    if (descriptor == -1 || stream == NULL) {
+        BENCHMARK_SKIP("a temporary file could not be created");
+    }
+    (void) close(descriptor);
+    const RESULT_VOID(io_error) opened = result_log_open(&log, path, CAPACITY);
+    (void) unlink(path);
+    if (RESULT_HAS_FAILURE(opened)) {
+        BENCHMARK_SKIP("the log could not be mapped");
+    }
+    BENCHMARK_PRINT_HEADER();
+    BENCHMARK_RUN("atomic add + store", sizeof(ring[0]), COUNT,
+        for (int index = 0; index < COUNT; index++) {
+            const uint64_t position = __atomic_fetch_add(&head, 1,
+                __ATOMIC_RELAXED);
+            struct result_log_record *record = &ring[position % CAPACITY];
+            record->_timestamp = position;
+            record->_failure = index;
+            record->_callsite = 1;
+            record->_thread = 1;
+            record->_sequence = position + 1;
+        });
+    BENCHMARK_RUN("result_log_append", sizeof(ring[0]), COUNT,
+        for (int index = 0; index < COUNT; index++) {
+            result_log_append(&log, 1, index);
+        });
+    BENCHMARK_RUN("fprintf", sizeof(ring[0]), COUNT,
+        for (int index = 0; index < COUNT; index++) {
+            (void) fprintf(stream, "thread=%u callsite=%d failure=%d\n",
+                result_log_thread(), 1, index);
+        });
+    result_log_close(&log);
+    (void) fclose(stream);
+    return EXIT_SUCCESS;
+}
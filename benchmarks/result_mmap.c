@@ -0,0 +1,81 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <result_mmap.h>
+#include "benchmark.h"
+
+#define LINES 1000000
+#define LINE_LENGTH 128
+
+/* Sums the decimal digits of a line, as a stand-in for parsing it */
+static long long checksum(const char *data, size_t length) {
+    long long sum = 0;
+    for (size_t index = 0; index < length; index++) {
+        if (data[index] >= '0' && data[index] <= '9') {
+            sum += data[index] - '0';
+        }
+    }
+    return sum;
+}
+
+/**
+ * Benchmarks memory-mapped line reading versus `fgets`.
+ */
+int main() {
+    char path[] = "/tmp/result_mmap_XXXXXX";
+    const int descriptor = mkstemp(path);
+    if (descriptor == -1) {
+        BENCHMARK_SKIP("a temporary file cannot be created");
+    }
+    FILE *file = fdopen(descriptor, "w+");
+    size_t bytes = 0;
+    for (int line = 0; line < LINES; line++) {
+        const int length = fprintf(file, "%d,pet-%d,%s\n", line, line,
+            line % 3 == 0 ? "available" : line % 3 == 1 ? "pending" : "sold");
+        bytes += (size_t) length;
+    }
+    (void) fflush(file);
+    long long by_fgets = 0;
+    long long by_mmap = 0;
+    BENCHMARK_PRINT_HEADER();
+    BENCHMARK_RUN("fgets", bytes / LINES, LINES, {
+        char buffer[LINE_LENGTH];
+        rewind(file);
+        while (fgets(buffer, sizeof(buffer), file) != NULL) {
+            by_fgets += checksum(buffer, strlen(buffer));
+        }
+    });
+    BENCHMARK_RUN("mmap_reader", bytes / LINES, LINES, {
+        struct mmap_reader reader;
+        if (RESULT_HAS_SUCCESS(mmap_reader_open(&reader, path))) {
+            RESULT(slice, io_error) line = mmap_reader_next_line(&reader);
+            while (RESULT_HAS_SUCCESS(line)) {
+                by_mmap += checksum(SLICE_DATA(RESULT_USE_SUCCESS(line)),
+                    SLICE_LENGTH(RESULT_USE_SUCCESS(line)));
+                line = mmap_reader_next_line(&reader);
+            }
+            mmap_reader_close(&reader);
+        }
+    });
+    (void) fclose(file);
+    (void) unlink(path);
+    if (by_fgets != by_mmap) {
+        BENCHMARK_FAIL("checksums differ");
+    }
+    return EXIT_SUCCESS;
+}
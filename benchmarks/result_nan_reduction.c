@@ -0,0 +1,79 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <result.h>
+#include "benchmark.h"
+
+#define COUNT 10000000
+
+typedef enum small_error {SMALL_ERROR_NONE, SMALL_ERROR_RANGE} small_error;
+
+RESULT_STRUCT(double, small_error);
+
+RESULT_STRUCT_NAN(small_error);
+
+static double reduce_regular(const RESULT(double, small_error) *results, size_t count) {
+    double total = 0.0;
+    for (size_t index = 0; index < count; index++) {
+        total += RESULT_OR_ELSE(results[index], 0.0);
+    }
+    return total;
+}
+
+static double reduce_nan(const RESULT_NAN(small_error) *results, size_t count) {
+    double total = 0.0;
+    for (size_t index = 0; index < count; index++) {
+        total += RESULT_NAN_OR_ELSE(results[index], 0.0);
+    }
+    return total;
+}
+
+/**
+ * Benchmarks a reduction over regular and NaN-boxed results.
+ */
+int main() {
+    RESULT(double, small_error) *regular = malloc(COUNT * sizeof(*regular));
+    RESULT_NAN(small_error) *boxed = malloc(COUNT * sizeof(*boxed));
+    double regular_total = 0.0;
+    double boxed_total = 0.0;
+
+    if (regular == NULL || boxed == NULL) {
+        BENCHMARK_SKIP("out of memory");
+    }
+
+    for (size_t index = 0; index < COUNT; index++) {
+        if (index % 64 == 0) {
+            regular[index] = (typeof(*regular)) RESULT_FAILURE(SMALL_ERROR_RANGE);
+            boxed[index] = (typeof(*boxed)) RESULT_NAN_FAILURE(SMALL_ERROR_RANGE);
+        } else {
+            regular[index] = (typeof(*regular)) RESULT_SUCCESS((double) (index % 1000));
+            boxed[index] = (typeof(*boxed)) RESULT_NAN_SUCCESS((double) (index % 1000));
+        }
+    }
+
+    BENCHMARK_PRINT_HEADER();
+    BENCHMARK_RUN("regular", sizeof(*regular), COUNT, regular_total = reduce_regular(regular, COUNT));
+    BENCHMARK_RUN("nan-boxed", sizeof(*boxed), COUNT, boxed_total = reduce_nan(boxed, COUNT));
+
+    free(regular);
+    free(boxed);
+
+    if (regular_total != boxed_total) {
+        BENCHMARK_FAIL("totals differ: %f != %f", regular_total, boxed_total);
+    }
+    return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <result_parse.h>
+#include "benchmark.h"
+
+#define COUNT 4096
+#define PASSES 64
+#define WIDTH 24
+
+static char texts[COUNT][WIDTH];
+
+/* Parses every text, sums the numbers, and checks the sum */
+#define BENCHMARK_PARSER(name, parse)                                          \
+  do {                                                                         \
+    long long sum = 0;                                                         \
+    BENCHMARK_RUN(name, WIDTH, COUNT * PASSES,                                 \
+      for (int pass = 0; pass < PASSES; pass++)                                \
+        for (size_t index = 0; index < COUNT; index++) {                       \
+          const char *text = texts[index];                                     \
+          parse;                                                               \
+        });                                                                    \
+    if (sum != expected * PASSES * BENCHMARK_REPETITIONS) {                    \
+      BENCHMARK_FAIL("%s computed a wrong sum", name);                         \
+    }                                                                          \
+  } while(0)
+
+/* Fills the texts with numbers of the supplied number of digits */
+static long long fill(int digits) {
+    long long expected = 0;
+    long long modulus = 1;
+    for (int digit = 0; digit < digits; digit++) {
+        modulus *= 10;
+    }
+    srand(digits);
+    for (size_t index = 0; index < COUNT; index++) {
+        const long long value = ((long long) rand() * RAND_MAX + rand())
+            % modulus;
+        (void) snprintf(texts[index], WIDTH, "%0*lld", digits, value);
+        expected += value;
+    }
+    return expected;
+}
+
+/**
+ * Benchmarks result-returning integer parsing versus the C library.
+ */
+int main() {
+    BENCHMARK_PRINT_HEADER();
+    const int lengths[] = {4, 9, 18};
+    for (size_t index = 0; index < sizeof(lengths) / sizeof(int); index++) {
+        const int digits = lengths[index];
+        const long long expected = fill(digits);
+        char names[3][WIDTH];
+        (void) snprintf(names[0], WIDTH, "sscanf %d digits", digits);
+        (void) snprintf(names[1], WIDTH, "strtoll %d digits", digits);
+        (void) snprintf(names[2], WIDTH, "parse_int64 %d digits", digits);
+        BENCHMARK_PARSER(names[0], {
+            long long value = 0;
+            if (sscanf(text, "%lld", &value) == 1) sum += value;
+        });
+        BENCHMARK_PARSER(names[1], {
+            char *end;
+            sum += strtoll(text, &end, 10);
+        });
+        BENCHMARK_PARSER(names[2], {
+            const RESULT(int64_t, parse_error) value = parse_int64(text);
+            if (RESULT_HAS_SUCCESS(value)) sum += RESULT_USE_SUCCESS(value);
+        });
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdlib.h>
+#include <string.h>
+#include <result_wire.h>
+#include "benchmark.h"
+
+#define COUNT 4096
+#define PASSES 64
+
+typedef struct reading {
+    int32_t sensor;
+    float value;
+} reading;
+
+typedef int reading_error;
+
+RESULT_STRUCT(reading, reading_error);
+
+RESULT_WIRE_FIXED_CODEC(reading, reading_error);
+
+static RESULT(reading, reading_error) results[COUNT];
+static RESULT(reading, reading_error) decoded[COUNT];
+static uint8_t buffer[COUNT * sizeof(results[0]) + WIRE_VARINT_MAX_SIZE];
+
+/* Fills the results, failing one out of eight */
+static void fill(void) {
+    srand(COUNT);
+    for (size_t index = 0; index < COUNT; index++) {
+        if (rand() % 8 == 0) {
+            results[index] = (RESULT(reading, reading_error))
+                RESULT_FAILURE(rand() % 200);
+        } else {
+            results[index] = (RESULT(reading, reading_error))
+                RESULT_SUCCESS(((reading) {(int32_t) index, 0.5f}));
+        }
+    }
+}
+
+/**
+ * Benchmarks the batch wire format versus copying the structs verbatim.
+ */
+int main() {
+    BENCHMARK_PRINT_HEADER();
+    fill();
+    struct wire_writer writer = wire_writer_init(buffer, sizeof(buffer));
+    bool failed = false;
+    BENCHMARK_RUN("memcpy encode", sizeof(results), COUNT * PASSES,
+        for (int pass = 0; pass < PASSES; pass++) {
+            memcpy(buffer, results, sizeof(results));
+        });
+    BENCHMARK_RUN("memcpy decode", sizeof(results), COUNT * PASSES,
+        for (int pass = 0; pass < PASSES; pass++) {
+            memcpy(decoded, buffer, sizeof(results));
+        });
+    BENCHMARK_RUN("wire batch encode", wire_writer_length(&writer),
+        COUNT * PASSES,
+        for (int pass = 0; pass < PASSES; pass++) {
+            writer = wire_writer_init(buffer, sizeof(buffer));
+            const RESULT_VOID(wire_error) encoded =
+                RESULT_WIRE_BATCH_ENCODER(reading, reading_error)(&writer,
+                    results, COUNT);
+            failed |= RESULT_HAS_FAILURE(encoded);
+        });
+    BENCHMARK_RUN("wire batch decode", wire_writer_length(&writer),
+        COUNT * PASSES,
+        for (int pass = 0; pass < PASSES; pass++) {
+            struct wire_reader reader = wire_reader_init(buffer,
+                wire_writer_length(&writer));
+            const RESULT(size_t, wire_error) count =
+                RESULT_WIRE_BATCH_DECODER(reading, reading_error)(&reader,
+                    decoded, COUNT);
+            failed |= RESULT_HAS_FAILURE(count);
+        });
+    if (failed) {
+        BENCHMARK_FAIL("the wire format could not be encoded or decoded");
+    }
+    for (size_t index = 0; index < COUNT; index++) {
+        if (RESULT_HAS_FAILURE(results[index])
+            ? RESULT_USE_FAILURE(results[index])
+                != RESULT_USE_FAILURE(decoded[index])
+            : RESULT_USE_SUCCESS(results[index]).sensor
+                != RESULT_USE_SUCCESS(decoded[index]).sensor) {
+            BENCHMARK_FAIL("the decoded results differ from the encoded ones");
+        }
+    }
+    return EXIT_SUCCESS;
+}
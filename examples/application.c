@@ -19,6 +19,7 @@
 /** [application] */
 #include <stdlib.h>
 #include <stdio.h>
+#include <result_parse.h>
 #include "pet-store.h"
 
 // Prints pet details
@@ -36,7 +37,7 @@ static void print_error(const pet_error error) {
 
 // Pet store application
 int main(int argc, char *argv[]) {
-  int pet_id;
+  RESULT(int, parse_error) pet_id;
   RESULT(Pet, pet_error) result;
 
   if (argc != 1) {
@@ -44,13 +45,15 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
-  if (sscanf(argv[0], "%d", &pet_id) != 1) {
-    printf("Error: Illegal pet ID provided: %s\n", argv[0]);
+  pet_id = parse_int(argv[0]);
+  if (RESULT_HAS_FAILURE(pet_id)) {
+    printf("Error: Illegal pet ID provided: %s (%s)\n", argv[0],
+      parse_error_message(RESULT_USE_FAILURE(pet_id)));
     return EXIT_FAILURE;
   }
 
-  printf("Finding pet %d...\n", pet_id);
-  result = find_pet(pet_id);
+  printf("Finding pet %d...\n", RESULT_USE_SUCCESS(pet_id));
+  result = find_pet(RESULT_USE_SUCCESS(pet_id));
   RESULT_IF_SUCCESS_OR_ELSE(result, print_pet, print_error);
 
   printf("Buying pet...\n");
@@ -0,0 +1,35 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <assert.h>
+#include <stdio.h>
+#include <result_copy.h>
+#include <result.h>
+#include "pet-store.h"
+
+int copy_report_example(void);
+
+int copy_report_example(void) {
+//! [result_copy_report]
+RESULT(Pet, pet_error) result = find_pet(0);
+RESULT_IF_SUCCESS(result, PET_NAME);
+struct result_copy_site heaviest[1];
+assert(result_copy_rank(heaviest, 1) == 1);
+result_copy_report(stdout, 5);
+//! [result_copy_report]
+    (void) heaviest;
+    return 0;
+}
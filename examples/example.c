@@ -18,17 +18,37 @@
 #include <string.h>
 #include <assert.h>
 #include <result.h>
+#include <result_io.h>
+#include <result_log.h>
+#include <result_message.h>
+#include <result_mmap.h>
+#include <result_parse.h>
+#include <result_string.h>
+#include <result_strview.h>
+#include <result_tls.h>
+#include <result_uring.h>
+#include <result_wire.h>
 #include <stdio.h>
 #include "pet-store.h"
 
 int pet_store_application(int argc, char *argv[]);
 
+int copy_report_example(void);
+
 RESULT_STRUCT(pet_status, pet_error);
 
 RESULT_STRUCT_TAG(Pet, const char *, RESULT_TAG(Pet, msg));
 
 RESULT_STRUCT_TAG(pet_status, const char *, RESULT_TAG(pet_status, msg));
 
+RESULT_STRUCT_TAG(Pet, struct result_message, RESULT_TAG(Pet, message));
+
+RESULT_STRUCT(Pet, result_string);
+
+//! [result_wire_codec]
+RESULT_WIRE_FIXED_CODEC(pet_status, pet_error);
+//! [result_wire_codec]
+
 typedef int IMPLEMENTATION;
 
 static struct pet default_pet = {.id = 100, .name = "Default pet", .status = AVAILABLE};
@@ -103,6 +123,60 @@ RESULT(pet_status, pet_error) get_pet_status(int id) {
 }
 /** [embracing_results] */
 
+/** [result_void] */
+RESULT_STRUCT_VOID(pet_error);
+
+// Checks whether a pet can be bought
+static RESULT_VOID(pet_error) check_available(Pet pet) {
+    if (PET_STATUS(pet) != AVAILABLE) {
+        return (RESULT_VOID(pet_error)) RESULT_FAILURE(PET_NOT_AVAILABLE);
+    }
+    return (RESULT_VOID(pet_error)) RESULT_VOID_SUCCESS();
+}
+/** [result_void] */
+
+RESULT_STRUCT_VOID_TAG(const char *, RESULT_TAG(void, msg));
+
+/** [result_static] */
+// Precomputed statuses, indexed by pet id
+static const RESULT(pet_status, pet_error) pet_statuses[] = {
+    RESULT_STATIC_SUCCESS(AVAILABLE),
+    RESULT_STATIC_SUCCESS(PENDING),
+    RESULT_STATIC_SUCCESS(SOLD),
+    RESULT_STATIC_FAILURE(PET_NOT_FOUND)
+};
+/** [result_static] */
+
+/** [result_emplace_fill] */
+// Constructs the status of a pet directly into the supplied slot
+static void emplace_pet_status(RESULT(pet_status, pet_error) *slot, size_t id) {
+    if (id > SOLD) {
+        RESULT_EMPLACE_FAILURE(slot, PET_NOT_FOUND);
+    } else {
+        RESULT_EMPLACE_SUCCESS(slot, (pet_status) id);
+    }
+}
+/** [result_emplace_fill] */
+
+/** [option] */
+OPTION_STRUCT_POINTER(Pet);
+
+// Returns a pet by name, if any
+static OPTION(Pet) find_pet_by_name(const char *name) {
+    for (int id = 0; id < 3; id++) {
+        RESULT(Pet, pet_error) result = find_pet(id);
+        if (RESULT_HAS_SUCCESS(result) && strcmp(PET_NAME(RESULT_USE_SUCCESS(result)), name) == 0) {
+            return (OPTION(Pet)) OPTION_SOME_POINTER(RESULT_USE_SUCCESS(result));
+        }
+    }
+    return (OPTION(Pet)) OPTION_NONE();
+}
+/** [option] */
+
+OPTION_STRUCT(pet_status);
+
+OPTION_STRUCT_POINTER_TAG(const char *, OPTION_TAG(msg));
+
 /**
  * Example snippets.
  */
@@ -113,6 +187,13 @@ RESULT_STRUCT(pet_status, pet_error);
 //! [result_struct]
     }
 
+    {
+//! [result_assert_register_return]
+RESULT_STRUCT(pet_status, pet_error);
+RESULT_ASSERT_REGISTER_RETURN(RESULT(pet_status, pet_error));
+//! [result_assert_register_return]
+    }
+
     {
 //! [result]
 RESULT(pet_status, pet_error) result;
@@ -143,6 +224,33 @@ RESULT(pet_status, pet_error) result = RESULT_FAILURE(PET_NOT_FOUND);
         (void) result;
     }
 
+    {
+        RESULT(pet_status, pet_error) result = pet_statuses[2];
+        assert(RESULT_USE_SUCCESS(result) == SOLD);
+        result = pet_statuses[3];
+        assert(RESULT_USE_FAILURE(result) == PET_NOT_FOUND);
+        (void) result;
+    }
+
+    {
+//! [result_emplace]
+RESULT(Pet, pet_error) slots[2];
+RESULT_EMPLACE_SUCCESS(&slots[0], &default_pet);
+RESULT_EMPLACE_FAILURE(&slots[1], PET_NOT_FOUND);
+assert(RESULT_USE_SUCCESS(slots[0]) == &default_pet);
+assert(RESULT_USE_FAILURE(slots[1]) == PET_NOT_FOUND);
+//! [result_emplace]
+    }
+
+    {
+//! [result_emplace_fill]
+RESULT(pet_status, pet_error) statuses[4];
+RESULT_EMPLACE_FILL(statuses, 4, emplace_pet_status);
+assert(RESULT_USE_SUCCESS(statuses[2]) == SOLD);
+assert(RESULT_USE_FAILURE(statuses[3]) == PET_NOT_FOUND);
+//! [result_emplace_fill]
+    }
+
     {
 //! [result_has_success]
 RESULT(pet_status, pet_error) result = RESULT_SUCCESS(AVAILABLE);
@@ -249,6 +357,40 @@ assert(last_error == PET_NOT_FOUND);
 //! [result_if_success_or_else]
     }
 
+    {
+RESULT_STRUCT(int, pet_error);
+//! [result_if_success_ref]
+#define set_side_effect_ref(value) set_side_effect(*(value))
+RESULT(int, pet_error) result = RESULT_SUCCESS(123);
+side_effect = 0;
+RESULT_IF_SUCCESS_REF(result, set_side_effect_ref);
+assert(side_effect == 123);
+//! [result_if_success_ref]
+    }
+
+    {
+RESULT_STRUCT(int, pet_error);
+//! [result_if_failure_ref]
+#define log_error_ref(error) log_error(*(error))
+RESULT(int, pet_error) result = RESULT_FAILURE(PET_NOT_FOUND);
+last_error = OK;
+RESULT_IF_FAILURE_REF(result, log_error_ref);
+assert(last_error == PET_NOT_FOUND);
+//! [result_if_failure_ref]
+    }
+
+    {
+RESULT_STRUCT(int, pet_error);
+//! [result_if_success_or_else_ref]
+RESULT(int, pet_error) result = RESULT_FAILURE(PET_NOT_FOUND);
+side_effect = 0;
+last_error = OK;
+RESULT_IF_SUCCESS_OR_ELSE_REF(result, set_side_effect_ref, log_error_ref);
+assert(side_effect == 0);
+assert(last_error == PET_NOT_FOUND);
+//! [result_if_success_or_else_ref]
+    }
+
 #define is_available(pet) (PET_STATUS(pet) == AVAILABLE)
 
     {
@@ -324,6 +466,32 @@ assert(RESULT_USE_SUCCESS(mapped) == SOLD);
 //! [result_map]
     }
 
+    {
+//! [result_map_success_in_place]
+#define MARK_AS_SOLD(status) (*(status) = SOLD)
+RESULT(pet_status, pet_error) result = RESULT_SUCCESS(PENDING);
+RESULT_MAP_SUCCESS_IN_PLACE(result, MARK_AS_SOLD);
+assert(RESULT_USE_SUCCESS(result) == SOLD);
+//! [result_map_success_in_place]
+    }
+
+    {
+//! [result_map_failure_in_place]
+#define MARK_AS_NOT_FOUND(error) (*(error) = PET_NOT_FOUND)
+RESULT(pet_status, pet_error) result = RESULT_FAILURE(PET_NOT_AVAILABLE);
+RESULT_MAP_FAILURE_IN_PLACE(result, MARK_AS_NOT_FOUND);
+assert(RESULT_USE_FAILURE(result) == PET_NOT_FOUND);
+//! [result_map_failure_in_place]
+    }
+
+    {
+//! [result_map_in_place]
+RESULT(pet_status, pet_error) result = RESULT_SUCCESS(PENDING);
+RESULT_MAP_IN_PLACE(result, MARK_AS_SOLD, MARK_AS_NOT_FOUND);
+assert(RESULT_USE_SUCCESS(result) == SOLD);
+//! [result_map_in_place]
+    }
+
     {
 //! [result_flat_map_success]
 struct pet sold = {.status = SOLD};
@@ -354,6 +522,293 @@ assert(PET_STATUS(RESULT_USE_SUCCESS(mapped)) == SOLD);
         (void) mapped;
     }
 
+    {
+//! [result_void_map_failure]
+struct pet sold = {.status = SOLD};
+RESULT_VOID(pet_error) result = check_available(&sold);
+RESULT_VOID(msg) mapped = RESULT_VOID_MAP_FAILURE(result, pet_error_message, typeof(mapped));
+assert(strcmp(RESULT_USE_FAILURE(mapped), "Pet not available") == 0);
+//! [result_void_map_failure]
+    }
+
+    {
+//! [result_table]
+static RESULT(Pet, pet_error) pets_by_id[3];
+RESULT_TABLE_FILL(pets_by_id, find_pet);
+RESULT(Pet, pet_error) result = RESULT_TABLE_GET(pets_by_id, 1, find_pet);
+assert(strcmp(PET_NAME(RESULT_USE_SUCCESS(result)), "Garfield") == 0);
+//! [result_table]
+        (void) result;
+    }
+
+    {
+//! [option_some]
+OPTION(pet_status) status = OPTION_SOME(AVAILABLE);
+assert(OPTION_USE_VALUE(status) == AVAILABLE);
+//! [option_some]
+        (void) status;
+    }
+
+    {
+//! [option_or_else]
+OPTION(Pet) option = find_pet_by_name("Nemo");
+Pet pet = OPTION_OR_ELSE(option, &default_pet);
+assert(pet == &default_pet);
+//! [option_or_else]
+        (void) pet;
+    }
+
+    {
+//! [option_map]
+OPTION(Pet) option = find_pet_by_name("Rantanplan");
+OPTION(pet_status) status = OPTION_MAP(option, PET_STATUS, typeof(status));
+assert(OPTION_USE_VALUE(status) == SOLD);
+//! [option_map]
+        (void) status;
+    }
+
+    {
+//! [option_flat_map]
+OPTION(msg) name = OPTION_SOME_POINTER("Garfield");
+OPTION(Pet) option = OPTION_FLAT_MAP(name, find_pet_by_name);
+assert(PET_ID(OPTION_USE_VALUE(option)) == 1);
+//! [option_flat_map]
+        (void) option;
+    }
+
+    {
+//! [option_filter]
+#define is_available(pet) (PET_STATUS(pet) == AVAILABLE)
+OPTION(Pet) option = find_pet_by_name("Garfield");
+OPTION(Pet) available = OPTION_FILTER(option, is_available);
+assert(OPTION_IS_EMPTY(available));
+//! [option_filter]
+#undef is_available
+        (void) available;
+    }
+
+    {
+//! [option_from_result]
+RESULT(Pet, pet_error) result = find_pet(-1);
+OPTION(Pet) option = OPTION_FROM_RESULT(result, typeof(option));
+assert(OPTION_IS_EMPTY(option));
+//! [option_from_result]
+        (void) option;
+    }
+
+    {
+//! [result_from_option]
+OPTION(Pet) option = find_pet_by_name("Nemo");
+RESULT(Pet, pet_error) result = RESULT_FROM_OPTION(option, PET_NOT_FOUND, typeof(result));
+assert(RESULT_USE_FAILURE(result) == PET_NOT_FOUND);
+//! [result_from_option]
+        (void) result;
+    }
+
+    {
+//! [result_nan]
+RESULT_STRUCT_NAN(pet_error);
+RESULT_NAN(pet_error) weights[] = {
+  RESULT_NAN_SUCCESS(4.5),
+  RESULT_NAN_FAILURE(PET_NOT_FOUND),
+  RESULT_NAN_SUCCESS(12.0)
+};
+double total = 0.0;
+for (int index = 0; index < 3; index++) {
+  total += RESULT_NAN_OR_ELSE(weights[index], 0.0);
+}
+assert(total == 16.5);
+assert(RESULT_NAN_HAS_FAILURE(weights[1]));
+assert(RESULT_NAN_USE_FAILURE(weights[1]) == PET_NOT_FOUND);
+//! [result_nan]
+        (void) total;
+    }
+
+    {
+//! [result_packed64]
+RESULT_STRUCT_PACKED64_TAG(pet_status, pet_error, RESULT_TAG(pet_status, packed_pet_error));
+static RESULT(pet_status, packed_pet_error) shared_status;
+RESULT(pet_status, packed_pet_error) status = RESULT_SUCCESS(SOLD);
+RESULT_PACKED64_STORE(&shared_status, status);
+RESULT(pet_status, packed_pet_error) latest = RESULT_PACKED64_LOAD(&shared_status);
+assert(sizeof(latest._word) == sizeof(uint64_t));
+assert(RESULT_USE_SUCCESS(latest) == SOLD);
+//! [result_packed64]
+        (void) latest;
+    }
+
+    {
+//! [result_boxed]
+typedef struct { pet_error code; char details[256]; } pet_failure;
+RESULT_STRUCT_BOXED(pet_status, pet_failure);
+static RESULT_ARENA(1024) failures;
+static const pet_failure out_of_memory = {.code = PET_NOT_FOUND, .details = "Out of memory"};
+pet_failure failure = {.code = PET_NOT_FOUND, .details = "Pet not found"};
+RESULT_BOXED(pet_status, pet_failure) result = RESULT_BOX_FAILURE(failures, failure, &out_of_memory);
+assert(sizeof(result) < sizeof(pet_failure));
+assert(RESULT_USE_FAILURE(result)->code == PET_NOT_FOUND);
+RESULT_ARENA_RESET(failures);
+//! [result_boxed]
+        (void) result;
+    }
+
+    {
+//! [result_tls]
+typedef struct { pet_error code; int pet_id; char reason[64]; } pet_failure;
+RESULT_STRUCT_TLS(pet_status, pet_failure);
+pet_failure failure = {.code = PET_NOT_FOUND, .pet_id = 42, .reason = "Unknown ID"};
+RESULT_TLS(pet_status, pet_failure) result = RESULT_TLS_FAILURE(RESULT_TLS(pet_status, pet_failure), failure);
+assert(sizeof(result) < sizeof(pet_failure));
+assert(RESULT_HAS_FAILURE(result));
+assert(RESULT_TLS_USE_FAILURE(result).pet_id == 42);
+//! [result_tls]
+        (void) result;
+    }
+
+    {
+//! [result_context]
+RESULT_STRUCT_CONTEXT(pet_error);
+RESULT_STRUCT_CONTEXTUAL(Pet, pet_error);
+static _Thread_local RESULT_ARENA(4096) contexts;
+RESULT_CONTEXTUAL(Pet, pet_error) failure = RESULT_CONTEXT_FAILURE(PET_NOT_FOUND);
+RESULT_CONTEXTUAL(Pet, pet_error) wrapped = RESULT_WRAP_FAILURE(contexts, failure, "while finding pet 42");
+RESULT_CONTEXTUAL(Pet, pet_error) result = RESULT_WRAP_FAILURE(contexts, wrapped, "while buying pet 42");
+assert(RESULT_USE_ROOT_FAILURE(result) == PET_NOT_FOUND);
+int depth = 0;
+for (const struct result_context *context = RESULT_USE_CONTEXT(result);
+     context != NULL; context = RESULT_CONTEXT_CAUSE(context)) {
+  assert(depth > 0 || strcmp(RESULT_CONTEXT_MESSAGE(context), "while buying pet 42") == 0);
+  depth++;
+}
+assert(depth == 2);
+RESULT_ARENA_RESET(contexts);
+//! [result_context]
+        (void) depth;
+    }
+
+    {
+//! [result_failure_fmt]
+RESULT(Pet, message) result = RESULT_FAILURE_FMT("Pet %d is %s", 42, "not available");
+char message[64];
+assert(strcmp(RESULT_FAILURE_MESSAGE(result, message, sizeof(message)), "Pet 42 is not available") == 0);
+//! [result_failure_fmt]
+        (void) result;
+        (void) message;
+    }
+
+    {
+//! [result_failure_str]
+RESULT(Pet, result_string) result = RESULT_FAILURE_STR("Pet %d is %s", 42, pet_status_name(SOLD));
+const char *message = RESULT_STRING_CHARS(RESULT_USE_FAILURE(result));
+assert(strcmp(message, "Pet 42 is Sold") == 0);
+//! [result_failure_str]
+        (void) message;
+    }
+
+    {
+//! [parse_int]
+RESULT(int, parse_error) result = parse_int("-123");
+assert(RESULT_USE_SUCCESS(result) == -123);
+result = parse_int("123abc");
+assert(RESULT_USE_FAILURE(result) == PARSE_ERROR_TRAILING);
+//! [parse_int]
+        (void) result;
+    }
+
+    {
+//! [result_from_errno]
+int descriptor = dup(-1);
+RESULT(int, io_error) result =
+  RESULT_FROM_ERRNO(descriptor, -1, RESULT(int, io_error));
+assert(RESULT_USE_FAILURE(result) == EBADF);
+//! [result_from_errno]
+        (void) result;
+    }
+
+    {
+//! [io_batch]
+char first[4], second[4];
+struct io_batch batch;
+RESULT_VOID(io_error) result = io_batch_init(&batch, 2, IO_BATCH_AUTO);
+assert(RESULT_HAS_SUCCESS(result));
+io_batch_pread(&batch, -1, first, sizeof(first), 0);
+io_batch_pread(&batch, -1, second, sizeof(second), 0);
+io_batch_submit(&batch);
+assert(RESULT_USE_FAILURE(io_batch_result(&batch, 1)) == EBADF);
+io_batch_destroy(&batch);
+//! [io_batch]
+        (void) result;
+    }
+
+    {
+//! [mmap_reader]
+struct mmap_reader reader;
+RESULT_VOID(io_error) result = mmap_reader_open(&reader, __FILE__);
+assert(RESULT_HAS_SUCCESS(result));
+RESULT(slice, io_error) line = mmap_reader_next_line(&reader);
+assert(memcmp(SLICE_DATA(RESULT_USE_SUCCESS(line)), "/*", 2) == 0);
+mmap_reader_close(&reader);
+//! [mmap_reader]
+        (void) result;
+        (void) line;
+    }
+
+    {
+//! [strview_split]
+strview rest = strview_of("1, 2, 3");
+int sum = 0;
+for (RESULT(strview, parse_error) token = strview_split(&rest, ',');
+    RESULT_HAS_SUCCESS(token); token = strview_split(&rest, ',')) {
+  RESULT(strview, parse_error) trimmed =
+    RESULT_MAP_SUCCESS(token, strview_trim, RESULT(strview, parse_error));
+  RESULT(int, parse_error) number =
+    RESULT_FLAT_MAP_SUCCESS(trimmed, strview_parse_int);
+  sum += RESULT_USE_SUCCESS(number);
+}
+assert(sum == 6);
+//! [strview_split]
+        (void) sum;
+    }
+
+    {
+//! [result_wire]
+uint8_t buffer[16];
+struct wire_writer writer = wire_writer_init(buffer, sizeof(buffer));
+RESULT(pet_status, pet_error) sent = RESULT_FAILURE(PET_NOT_FOUND);
+RESULT_VOID(wire_error) encoded =
+  RESULT_WIRE_ENCODER(pet_status, pet_error)(&writer, &sent);
+assert(RESULT_HAS_SUCCESS(encoded));
+struct wire_reader reader = wire_reader_init(buffer,
+  wire_writer_length(&writer));
+RESULT(pet_status, pet_error) received;
+RESULT_VOID(wire_error) decoded =
+  RESULT_WIRE_DECODER(pet_status, pet_error)(&reader, &received);
+assert(RESULT_HAS_SUCCESS(decoded));
+assert(RESULT_USE_FAILURE(received) == PET_NOT_FOUND);
+//! [result_wire]
+        (void) encoded;
+        (void) decoded;
+    }
+
+    {
+        char path[] = "/tmp/result_log_XXXXXX";
+        (void) close(mkstemp(path));
+//! [result_log]
+struct result_log log;
+RESULT_VOID(io_error) opened = result_log_open(&log, path, 1024);
+assert(RESULT_HAS_SUCCESS(opened));
+RESULT(Pet, pet_error) result = find_pet(-1);
+RESULT_LOG_FAILURE(&log, result);
+result_log_close(&log);
+//! [result_log]
+        (void) opened;
+        (void) unlink(path);
+    }
+
+    {
+        assert(copy_report_example() == 0);
+    }
+
     {
 //! [result_debug]
 RESULT(Pet, pet_error) failure = RESULT_FAILURE(PET_NOT_FOUND);
@@ -390,6 +845,7 @@ fprintf(stderr, "Failure at %s (%s:%d)\n",
         assert(pet_store_application(1, (char * []) { "1" }) != 0);
         assert(pet_store_application(1, (char * []) { "2" }) != 0);
         assert(pet_store_application(1, (char * []) { "3" }) != 0);
+        assert(pet_store_application(1, (char * []) { "1x" }) != 0);
     }
 
     return 0;
@@ -48,7 +48,9 @@
  */
 #define RESULT_VERSION 1
 
-#include <stddef.h> /* NULL */
+#include <stddef.h> /* NULL, max_align_t, offsetof, size_t */
+#include <stdint.h> /* uintptr_t, uint64_t */
+#include <string.h> /* memcpy, memset, strcmp */
 
 #ifndef __bool_true_false_are_defined
 #include <stdbool.h>
@@ -108,6 +110,267 @@
 
 #ifndef NDEBUG
 
+#ifdef RESULT_DEBUG_CALLSITES
+
+/**
+ * Represents the source code location where a result was created.
+ *
+ * When `RESULT_DEBUG_CALLSITES` is defined before including this header, debug
+ * results store a single pointer to one of these records instead of three
+ * separate fields. Records are emitted into the `__result_callsites` linker
+ * section, so that they can be enumerated at runtime via
+ * #result_callsites_begin and #result_callsites_end.
+ *
+ * @note
+ * Every record has the same size and alignment, so the section can be walked
+ * as a plain array.
+ *
+ * @see RESULT_CALLSITE_FUNC
+ * @see RESULT_CALLSITE_FILE
+ * @see RESULT_CALLSITE_LINE
+ */
+struct result_callsite {
+  _Alignas(32) const char * _func;
+  const char * _file;
+  int _line;
+};
+
+_Static_assert(sizeof(struct result_callsite) == 32,
+  "Callsite records must have a uniform stride");
+
+/**
+ * Declares the debug information member of a result struct.
+ *
+ * @warning
+ * This macro is an implementation detail and SHOULD NOT be used directly.
+ */
+#define RESULT_DEBUG_INFO                                                   \
+  struct {                                                                  \
+    const struct result_callsite * _site;                                   \
+  }
+
+/**
+ * Initializes the debug information of a result with the current location.
+ *
+ * The callsite record is a static constant placed in the `__result_callsites`
+ * section.
+ *
+ * @warning
+ * This macro is an implementation detail and SHOULD NOT be used directly.
+ */
+#define RESULT_DEBUG_HERE                                                   \
+  {                                                                         \
+    ._site = __extension__ ({                                               \
+      static const struct result_callsite _callsite                         \
+        __attribute__((section("__result_callsites"), used)) = {            \
+          ._func = __func__,                                                \
+          ._file = __FILE__,                                                \
+          ._line = __LINE__                                                 \
+        };                                                                  \
+      &_callsite;                                                           \
+    })                                                                      \
+  }
+
+/**
+ * Initializes the debug information of a static result.
+ *
+ * Static results cannot point to a callsite record and remain constant
+ * expressions at block scope, so the line number is stored in the callsite
+ * pointer itself, shifted and tagged with its lowest bit. Callsite records are
+ * aligned to 32 bytes, so they never have that bit set.
+ *
+ * @warning
+ * This macro is an implementation detail and SHOULD NOT be used directly.
+ */
+#define RESULT_DEBUG_STATIC                                                 \
+  {                                                                         \
+    ._site = (const struct result_callsite *)                               \
+      (((uintptr_t) __LINE__ << 1) | 1)                                     \
+  }
+
+/**
+ * Checks whether the debug information of a result points to a callsite
+ * record.
+ *
+ * @warning
+ * This function is an implementation detail and SHOULD NOT be called directly.
+ *
+ * @param site The callsite pointer of the result.
+ * @return `true` if @p site points to a callsite record; `false` if it is
+ *   `NULL` or holds the line number of a static result.
+ */
+static inline bool result_callsite_is_record(
+    const struct result_callsite * site) {
+  return site != NULL && ((uintptr_t) site & 1) == 0;
+}
+
+/**
+ * Loads the debug information of a result.
+ *
+ * @warning
+ * This function is an implementation detail and SHOULD NOT be called directly.
+ *
+ * @param site The callsite pointer of the result.
+ * @return A copy of the callsite record; for static results, a record holding
+ *   the line number only; for results without debug information, such as
+ *   zero-initialized or unpacked ones, an empty record.
+ */
+static inline struct result_callsite result_callsite_load(
+    const struct result_callsite * site) {
+  if (result_callsite_is_record(site)) {
+    return *site;
+  }
+  return (struct result_callsite) {
+    ._func = NULL,
+    ._file = NULL,
+    ._line = (int) ((uintptr_t) site >> 1)
+  };
+}
+
+/**
+ * Returns a member of the debug information of a result.
+ *
+ * @warning
+ * This macro is an implementation detail and SHOULD NOT be used directly.
+ *
+ * @param result The result.
+ * @param member The callsite member.
+ * @return The callsite member, or `NULL` or zero if @p result has no debug
+ *   information.
+ */
+#define RESULT_DEBUG_MEMBER(result, member)                                 \
+  (result_callsite_load((result)._debug._site).member)
+
+/**
+ * The first callsite record, provided by the linker.
+ *
+ * @warning
+ * This variable is an implementation detail of #result_callsites_begin and
+ * SHOULD NOT be accessed directly.
+ */
+extern const struct result_callsite __start___result_callsites[]
+  __attribute__((weak));
+
+/**
+ * One past the last callsite record, provided by the linker.
+ *
+ * @warning
+ * This variable is an implementation detail of #result_callsites_end and
+ * SHOULD NOT be accessed directly.
+ */
+extern const struct result_callsite __stop___result_callsites[]
+  __attribute__((weak));
+
+/**
+ * Returns the first callsite record of the program.
+ *
+ * @return A pointer to the first callsite record, or `NULL` if there is none.
+ *
+ * @see result_callsites_end
+ */
+static inline const struct result_callsite * result_callsites_begin(void) {
+  return __start___result_callsites;
+}
+
+/**
+ * Returns one past the last callsite record of the program.
+ *
+ * @return A pointer one past the last callsite record, or `NULL` if there is
+ *   none.
+ *
+ * @see result_callsites_begin
+ */
+static inline const struct result_callsite * result_callsites_end(void) {
+  return __stop___result_callsites;
+}
+
+/**
+ * Returns the name of the function of the supplied callsite record.
+ *
+ * @param callsite The callsite record.
+ * @return The function name.
+ */
+#define RESULT_CALLSITE_FUNC(callsite)                                      \
+  ((callsite)->_func)
+
+/**
+ * Returns the source file name of the supplied callsite record.
+ *
+ * @param callsite The callsite record.
+ * @return The source file name.
+ */
+#define RESULT_CALLSITE_FILE(callsite)                                      \
+  ((callsite)->_file)
+
+/**
+ * Returns the line number of the supplied callsite record.
+ *
+ * @param callsite The callsite record.
+ * @return The line number.
+ */
+#define RESULT_CALLSITE_LINE(callsite)                                      \
+  ((callsite)->_line)
+
+#else
+
+/**
+ * Declares the debug information member of a result struct.
+ *
+ * @warning
+ * This macro is an implementation detail and SHOULD NOT be used directly.
+ */
+#define RESULT_DEBUG_INFO                                                   \
+  struct {                                                                  \
+    const char * _func;                                                     \
+    const char * _file;                                                     \
+    int _line;                                                              \
+  }
+
+/**
+ * Initializes the debug information of a result with the current location.
+ *
+ * @warning
+ * This macro is an implementation detail and SHOULD NOT be used directly.
+ */
+#define RESULT_DEBUG_HERE                                                   \
+  {                                                                         \
+    ._func = __func__,                                                      \
+    ._file = __FILE__,                                                      \
+    ._line = __LINE__                                                       \
+  }
+
+/**
+ * Initializes the debug information of a static result.
+ *
+ * @warning
+ * This macro is an implementation detail and SHOULD NOT be used directly.
+ */
+#define RESULT_DEBUG_STATIC                                                 \
+  {                                                                         \
+    ._func = NULL,                                                          \
+    ._file = NULL,                                                          \
+    ._line = __LINE__                                                       \
+  }
+
+/**
+ * Returns a member of the debug information of a result.
+ *
+ * @warning
+ * This macro is an implementation detail and SHOULD NOT be used directly.
+ *
+ * @param result The result.
+ * @param member The debug information member.
+ * @return The debug information member.
+ */
+#define RESULT_DEBUG_MEMBER(result, member)                                 \
+  ((result)._debug.member)
+
+#endif
+
+#endif
+
+#ifndef NDEBUG
+
 /**
  * Initializes a new successful result containing the supplied value.
  *
@@ -125,11 +388,7 @@
     ._value = {                                                             \
       ._success = (success)                                                 \
     },                                                                      \
-    ._debug = {                                                             \
-      ._func = __func__,                                                    \
-      ._file = __FILE__,                                                    \
-      ._line = __LINE__                                                     \
-    }                                                                       \
+    ._debug = RESULT_DEBUG_HERE                                             \
   }
 
 #else
@@ -174,11 +433,7 @@
   ._value = {                                                               \
     ._failure = (failure)                                                   \
   },                                                                        \
-  ._debug = {                                                               \
-    ._func = __func__,                                                      \
-    ._file = __FILE__,                                                      \
-    ._line = __LINE__                                                       \
-  }                                                                         \
+  ._debug = RESULT_DEBUG_HERE                                               \
 }
 
 #else
@@ -204,123 +459,393 @@
 
 #endif
 
+#ifndef NDEBUG
+
 /**
- * Checks if a result contains a success value.
+ * Initializes a new successful result that is a constant expression.
+ *
+ * Unlike #RESULT_SUCCESS, this initializer can be used for objects with static
+ * storage duration (such as file-scope lookup tables) and @p constexpr objects,
+ * as long as @b success is a constant expression.
+ *
+ * @note
+ * The function name and source file name where the result was created are not
+ * recorded, so that the initializer remains a constant expression.
  *
  * @b Example:
- * @snippet example.c result_has_success
+ * @snippet example.c result_static
  *
- * @param result The result to check for success.
- * @return @p true if @b result is successful; otherwise @p false.
+ * @param success The success value.
+ * @return The constant initializer for a successful result holding
+ *   @b success.
  *
- * @see RESULT_HAS_FAILURE
+ * @see RESULT_STATIC_FAILURE
  */
-#define RESULT_HAS_SUCCESS(result)                                          \
-  (!(result)._failed)
+#define RESULT_STATIC_SUCCESS(success)                                      \
+  {                                                                         \
+    ._failed = false,                                                       \
+    ._value = {                                                             \
+      ._success = (success)                                                 \
+    },                                                                      \
+    ._debug = RESULT_DEBUG_STATIC                                           \
+  }
+
+#else
 
 /**
- * Checks if a result contains a failure value.
+ * Initializes a new successful result that is a constant expression.
+ *
+ * Unlike #RESULT_SUCCESS, this initializer can be used for objects with static
+ * storage duration (such as file-scope lookup tables) and @p constexpr objects,
+ * as long as @b success is a constant expression.
+ *
+ * @note
+ * The function name and source file name where the result was created are not
+ * recorded, so that the initializer remains a constant expression.
  *
  * @b Example:
- * @snippet example.c result_has_failure
+ * @snippet example.c result_static
  *
- * @param result The result to check for failure.
- * @return @p true if @b result is failed; otherwise @p false.
+ * @param success The success value.
+ * @return The constant initializer for a successful result holding
+ *   @b success.
  *
- * @see RESULT_HAS_SUCCESS
+ * @see RESULT_STATIC_FAILURE
  */
-#define RESULT_HAS_FAILURE(result)                                          \
-  ((result)._failed)
+#define RESULT_STATIC_SUCCESS(success)                                      \
+  {                                                                         \
+    ._failed = false,                                                       \
+    ._value = {                                                             \
+      ._success = (success)                                                 \
+    }                                                                       \
+  }
+
+#endif
+
+#ifndef NDEBUG
 
 /**
- * Returns a result's success value.
+ * Initializes a new failed result that is a constant expression.
  *
- * @pre @b result MUST be successful.
+ * Unlike #RESULT_FAILURE, this initializer can be used for objects with static
+ * storage duration (such as file-scope lookup tables) and @p constexpr objects,
+ * as long as @b failure is a constant expression.
  *
- * @warning
- * If @b result is failed, the appropriate part of the object representation of
- * the failure value is reinterpreted as a success value (a process sometimes
- * called "type punning"), which may be a trap representation.
+ * @note
+ * The function name and source file name where the result was created are not
+ * recorded, so that the initializer remains a constant expression.
  *
  * @b Example:
- * @snippet example.c result_use_success
+ * @snippet example.c result_static
  *
- * @param result The result to retrieve the success value from.
- * @return @b result's success value.
+ * @param failure The failure value.
+ * @return The constant initializer for a failed result holding @b failure.
  *
- * @see RESULT_USE_FAILURE
+ * @see RESULT_STATIC_SUCCESS
  */
-#define RESULT_USE_SUCCESS(result)                                          \
-  ((result)._value._success)
+#define RESULT_STATIC_FAILURE(failure)                                      \
+  {                                                                         \
+    ._failed = true,                                                        \
+    ._value = {                                                             \
+      ._failure = (failure)                                                 \
+    },                                                                      \
+    ._debug = RESULT_DEBUG_STATIC                                           \
+  }
+
+#else
 
 /**
- * Returns a result's failure value.
+ * Initializes a new failed result that is a constant expression.
  *
- * @pre @b result MUST be failed.
+ * Unlike #RESULT_FAILURE, this initializer can be used for objects with static
+ * storage duration (such as file-scope lookup tables) and @p constexpr objects,
+ * as long as @b failure is a constant expression.
  *
- * @warning
- * If @b result is successful, the appropriate part of the object representation
- * of the success value is reinterpreted as a failure value (a process sometimes
- * called "type punning"), which may be a trap representation.
+ * @note
+ * The function name and source file name where the result was created are not
+ * recorded, so that the initializer remains a constant expression.
  *
  * @b Example:
- * @snippet example.c result_use_failure
+ * @snippet example.c result_static
  *
- * @param result The result to retrieve the failure value from.
- * @return @b result's failure value.
+ * @param failure The failure value.
+ * @return The constant initializer for a failed result holding @b failure.
  *
- * @see RESULT_USE_FAILURE
+ * @see RESULT_STATIC_SUCCESS
  */
-#define RESULT_USE_FAILURE(result)                                          \
-  ((result)._value._failure)
+#define RESULT_STATIC_FAILURE(failure)                                      \
+  {                                                                         \
+    ._failed = true,                                                        \
+    ._value = {                                                             \
+      ._failure = (failure)                                                 \
+    }                                                                       \
+  }
+
+#endif
+
+#ifndef NDEBUG
 
 /**
- * Returns a result's success value as a possibly-null pointer.
+ * Constructs a successful result directly into caller-provided storage.
  *
- * @pre @b result MUST be an @e value.
+ * Unlike #RESULT_SUCCESS, no temporary result is created: the members of the
+ * result pointed to by @b destination are assigned one by one.
+ *
+ * @note
+ * The success value may contain unparenthesized commas, such as those in
+ * compound literals.
  *
  * @b Example:
- * @snippet example.c result_get_success
+ * @snippet example.c result_emplace
  *
- * @param result The result to retrieve the success value from.
- * @return A pointer to @b result's success value if successful; otherwise
- *   @p NULL.
+ * @param destination The pointer to the result to construct. It is evaluated
+ *   only once.
+ * @param ... The success value.
  *
- * @see RESULT_GET_FAILURE
+ * @see RESULT_EMPLACE_FAILURE
+ * @see RESULT_EMPLACE_FILL
  */
-#define RESULT_GET_SUCCESS(result)                                          \
-  (                                                                         \
-    (void) &(result),                                                       \
-    RESULT_HAS_FAILURE(result)                                              \
-    ? NULL                                                                  \
-    : &RESULT_USE_SUCCESS(result)                                           \
-  )
+#define RESULT_EMPLACE_SUCCESS(destination, ...)                            \
+  do {                                                                      \
+    typeof(destination) const _destination = (destination);                 \
+    _destination->_failed = false;                                          \
+    _destination->_value._success = (__VA_ARGS__);                          \
+    _destination->_debug =                                                  \
+      (typeof(_destination->_debug)) RESULT_DEBUG_HERE;                     \
+  } while(false)
 
 /**
- * Returns a result's failure value as a possibly-null pointer.
+ * Constructs a failed result directly into caller-provided storage.
  *
- * @pre @b result MUST be an @e lvalue.
+ * Unlike #RESULT_FAILURE, no temporary result is created: the members of the
+ * result pointed to by @b destination are assigned one by one.
+ *
+ * @note
+ * The failure value may contain unparenthesized commas, such as those in
+ * compound literals.
  *
  * @b Example:
- * @snippet example.c result_get_failure
+ * @snippet example.c result_emplace
  *
- * @param result The result to retrieve the failure value from.
- * @return A pointer to @b result's failure value if failed; otherwise @p NULL.
+ * @param destination The pointer to the result to construct. It is evaluated
+ *   only once.
+ * @param ... The failure value.
  *
- * @see RESULT_GET_SUCCESS
+ * @see RESULT_EMPLACE_SUCCESS
+ * @see RESULT_EMPLACE_FILL
  */
-#define RESULT_GET_FAILURE(result)                                          \
-  (                                                                         \
-    (void) &(result),                                                       \
-    RESULT_HAS_FAILURE(result)                                              \
-    ? &RESULT_USE_FAILURE(result)                                           \
-    : NULL                                                                  \
-  )
+#define RESULT_EMPLACE_FAILURE(destination, ...)                            \
+  do {                                                                      \
+    typeof(destination) const _destination = (destination);                 \
+    _destination->_failed = true;                                           \
+    _destination->_value._failure = (__VA_ARGS__);                          \
+    _destination->_debug =                                                  \
+      (typeof(_destination->_debug)) RESULT_DEBUG_HERE;                     \
+  } while(false)
+
+#else
 
 /**
- * Returns a result's success value, or the supplied one.
+ * Constructs a successful result directly into caller-provided storage.
  *
- * @pre @b result MUST be an @e lvalue.
+ * Unlike #RESULT_SUCCESS, no temporary result is created: the members of the
+ * result pointed to by @b destination are assigned one by one.
+ *
+ * @note
+ * The success value may contain unparenthesized commas, such as those in
+ * compound literals.
+ *
+ * @b Example:
+ * @snippet example.c result_emplace
+ *
+ * @param destination The pointer to the result to construct. It is evaluated
+ *   only once.
+ * @param ... The success value.
+ *
+ * @see RESULT_EMPLACE_FAILURE
+ * @see RESULT_EMPLACE_FILL
+ */
+#define RESULT_EMPLACE_SUCCESS(destination, ...)                            \
+  do {                                                                      \
+    typeof(destination) const _destination = (destination);                 \
+    _destination->_failed = false;                                          \
+    _destination->_value._success = (__VA_ARGS__);                          \
+  } while(false)
+
+/**
+ * Constructs a failed result directly into caller-provided storage.
+ *
+ * Unlike #RESULT_FAILURE, no temporary result is created: the members of the
+ * result pointed to by @b destination are assigned one by one.
+ *
+ * @note
+ * The failure value may contain unparenthesized commas, such as those in
+ * compound literals.
+ *
+ * @b Example:
+ * @snippet example.c result_emplace
+ *
+ * @param destination The pointer to the result to construct. It is evaluated
+ *   only once.
+ * @param ... The failure value.
+ *
+ * @see RESULT_EMPLACE_SUCCESS
+ * @see RESULT_EMPLACE_FILL
+ */
+#define RESULT_EMPLACE_FAILURE(destination, ...)                            \
+  do {                                                                      \
+    typeof(destination) const _destination = (destination);                 \
+    _destination->_failed = true;                                           \
+    _destination->_value._failure = (__VA_ARGS__);                          \
+  } while(false)
+
+#endif
+
+/**
+ * Constructs an array of results directly via the supplied generator.
+ *
+ * For each index, @b generator receives a pointer to the corresponding element
+ * of @b destination along with the index itself, and is expected to construct
+ * the result in place via #RESULT_EMPLACE_SUCCESS or #RESULT_EMPLACE_FAILURE.
+ *
+ * @b Example:
+ * @snippet example.c result_emplace_fill
+ *
+ * @param destination The pointer to the first result to construct. It is
+ *   evaluated only once.
+ * @param count The number of results to construct.
+ * @param generator The function or macro that constructs the result for an
+ *   index.
+ *
+ * @see RESULT_EMPLACE_SUCCESS
+ * @see RESULT_EMPLACE_FAILURE
+ */
+#define RESULT_EMPLACE_FILL(destination, count, generator)                  \
+  do {                                                                      \
+    typeof(&(destination)[0]) const _results = (destination);               \
+    const size_t _count = (count);                                          \
+    for (size_t _index = 0; _index < _count; _index++) {                    \
+      (void) (generator(&_results[_index], _index));                        \
+    }                                                                       \
+  } while(false)
+
+/**
+ * Checks if a result contains a success value.
+ *
+ * @b Example:
+ * @snippet example.c result_has_success
+ *
+ * @param result The result to check for success.
+ * @return @p true if @b result is successful; otherwise @p false.
+ *
+ * @see RESULT_HAS_FAILURE
+ */
+#define RESULT_HAS_SUCCESS(result)                                          \
+  (!(result)._failed)
+
+/**
+ * Checks if a result contains a failure value.
+ *
+ * @b Example:
+ * @snippet example.c result_has_failure
+ *
+ * @param result The result to check for failure.
+ * @return @p true if @b result is failed; otherwise @p false.
+ *
+ * @see RESULT_HAS_SUCCESS
+ */
+#define RESULT_HAS_FAILURE(result)                                          \
+  ((result)._failed)
+
+/**
+ * Returns a result's success value.
+ *
+ * @pre @b result MUST be successful.
+ *
+ * @warning
+ * If @b result is failed, the appropriate part of the object representation of
+ * the failure value is reinterpreted as a success value (a process sometimes
+ * called "type punning"), which may be a trap representation.
+ *
+ * @b Example:
+ * @snippet example.c result_use_success
+ *
+ * @param result The result to retrieve the success value from.
+ * @return @b result's success value.
+ *
+ * @see RESULT_USE_FAILURE
+ */
+#define RESULT_USE_SUCCESS(result)                                          \
+  ((result)._value._success)
+
+/**
+ * Returns a result's failure value.
+ *
+ * @pre @b result MUST be failed.
+ *
+ * @warning
+ * If @b result is successful, the appropriate part of the object representation
+ * of the success value is reinterpreted as a failure value (a process sometimes
+ * called "type punning"), which may be a trap representation.
+ *
+ * @b Example:
+ * @snippet example.c result_use_failure
+ *
+ * @param result The result to retrieve the failure value from.
+ * @return @b result's failure value.
+ *
+ * @see RESULT_USE_FAILURE
+ */
+#define RESULT_USE_FAILURE(result)                                          \
+  ((result)._value._failure)
+
+/**
+ * Returns a result's success value as a possibly-null pointer.
+ *
+ * @pre @b result MUST be an @e value.
+ *
+ * @b Example:
+ * @snippet example.c result_get_success
+ *
+ * @param result The result to retrieve the success value from.
+ * @return A pointer to @b result's success value if successful; otherwise
+ *   @p NULL.
+ *
+ * @see RESULT_GET_FAILURE
+ */
+#define RESULT_GET_SUCCESS(result)                                          \
+  (                                                                         \
+    (void) &(result),                                                       \
+    RESULT_HAS_FAILURE(result)                                              \
+    ? NULL                                                                  \
+    : &RESULT_USE_SUCCESS(result)                                           \
+  )
+
+/**
+ * Returns a result's failure value as a possibly-null pointer.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c result_get_failure
+ *
+ * @param result The result to retrieve the failure value from.
+ * @return A pointer to @b result's failure value if failed; otherwise @p NULL.
+ *
+ * @see RESULT_GET_SUCCESS
+ */
+#define RESULT_GET_FAILURE(result)                                          \
+  (                                                                         \
+    (void) &(result),                                                       \
+    RESULT_HAS_FAILURE(result)                                              \
+    ? &RESULT_USE_FAILURE(result)                                           \
+    : NULL                                                                  \
+  )
+
+/**
+ * Returns a result's success value, or the supplied one.
+ *
+ * @pre @b result MUST be an @e lvalue.
  *
  * @b Example:
  * @snippet example.c result_or_else
@@ -379,6 +904,7 @@
 #define RESULT_IF_SUCCESS(result, action)                                   \
   do {                                                                      \
     typeof(result) _result = (result);                                      \
+    RESULT_COPY_HOOK(sizeof(_result));                                      \
     if (RESULT_HAS_SUCCESS(_result)) {                                      \
       (void) (action(RESULT_USE_SUCCESS(_result)));                         \
     }                                                                       \
@@ -400,6 +926,7 @@
 #define RESULT_IF_FAILURE(result, action)                                   \
   do {                                                                      \
     typeof(result) _result = (result);                                      \
+    RESULT_COPY_HOOK(sizeof(_result));                                      \
     if (RESULT_HAS_FAILURE(_result)) {                                      \
       (void) (action(RESULT_USE_FAILURE(_result)));                         \
     }                                                                       \
@@ -423,6 +950,7 @@
 #define RESULT_IF_SUCCESS_OR_ELSE(result, success_action, failure_action)   \
   do {                                                                      \
     typeof(result) _result = (result);                                      \
+    RESULT_COPY_HOOK(sizeof(_result));                                      \
     if (RESULT_HAS_FAILURE(_result)) {                                      \
       (void) (failure_action(RESULT_USE_FAILURE(_result)));                 \
     } else {                                                                \
@@ -430,6 +958,89 @@
     }                                                                       \
   } while(false)
 
+/**
+ * Performs the supplied action with a pointer to a successful result's value.
+ *
+ * Unlike #RESULT_IF_SUCCESS, neither the result nor its success value are
+ * copied: @b action receives a `const` pointer to @b result's success value.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c result_if_success_ref
+ *
+ * @param result The result whose success value will be used.
+ * @param action The function or macro to be applied to a pointer to
+ *   @b result's success value.
+ *
+ * @see RESULT_IF_FAILURE_REF
+ * @see RESULT_IF_SUCCESS_OR_ELSE_REF
+ */
+#define RESULT_IF_SUCCESS_REF(result, action)                               \
+  do {                                                                      \
+    const typeof(result) * _result = &(result);                             \
+    if (RESULT_HAS_SUCCESS(*_result)) {                                     \
+      (void) (action(&RESULT_USE_SUCCESS(*_result)));                       \
+    }                                                                       \
+  } while(false)
+
+/**
+ * Performs the supplied action with a pointer to a failed result's value.
+ *
+ * Unlike #RESULT_IF_FAILURE, neither the result nor its failure value are
+ * copied: @b action receives a `const` pointer to @b result's failure value.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c result_if_failure_ref
+ *
+ * @param result The result whose failure value will be used.
+ * @param action The function or macro to be applied to a pointer to
+ *   @b result's failure value.
+ *
+ * @see RESULT_IF_SUCCESS_REF
+ * @see RESULT_IF_SUCCESS_OR_ELSE_REF
+ */
+#define RESULT_IF_FAILURE_REF(result, action)                               \
+  do {                                                                      \
+    const typeof(result) * _result = &(result);                             \
+    if (RESULT_HAS_FAILURE(*_result)) {                                     \
+      (void) (action(&RESULT_USE_FAILURE(*_result)));                       \
+    }                                                                       \
+  } while(false)
+
+/**
+ * Performs either of the supplied actions with a pointer to a result's value.
+ *
+ * Unlike #RESULT_IF_SUCCESS_OR_ELSE, neither the result nor its value are
+ * copied: the actions receive a `const` pointer to @b result's value.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c result_if_success_or_else_ref
+ *
+ * @param result The result whose value will be used.
+ * @param success_action The function or macro to be applied to a pointer to
+ *   @b result's success value.
+ * @param failure_action The function or macro to be applied to a pointer to
+ *   @b result's failure value.
+ *
+ * @see RESULT_IF_SUCCESS_REF
+ * @see RESULT_IF_FAILURE_REF
+ */
+#define RESULT_IF_SUCCESS_OR_ELSE_REF(                                      \
+    result, success_action, failure_action)                                 \
+  do {                                                                      \
+    const typeof(result) * _result = &(result);                             \
+    if (RESULT_HAS_FAILURE(*_result)) {                                     \
+      (void) (failure_action(&RESULT_USE_FAILURE(*_result)));               \
+    } else {                                                                \
+      (void) (success_action(&RESULT_USE_SUCCESS(*_result)));               \
+    }                                                                       \
+  } while(false)
+
 /**
  * Conditionally transforms a successful result into a failed one.
  *
@@ -451,6 +1062,7 @@
 #define RESULT_FILTER(result, is_acceptable, failure)                       \
   (                                                                         \
     (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(result)),                                       \
     RESULT_HAS_FAILURE(result)                                              \
             || (is_acceptable(RESULT_USE_SUCCESS(result)))                  \
     ? (result)                                                              \
@@ -504,6 +1116,7 @@
 #define RESULT_RECOVER(result, is_recoverable, success)                     \
   (                                                                         \
     (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(result)),                                       \
     RESULT_HAS_FAILURE(result)                                              \
             && (is_recoverable(RESULT_USE_FAILURE(result)))                 \
     ? (typeof(result)) RESULT_SUCCESS(success)                              \
@@ -558,6 +1171,7 @@
 #define RESULT_MAP_SUCCESS(result, success_mapper, result_type)             \
   (                                                                         \
     (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(result_type)),                                  \
     RESULT_HAS_FAILURE(result)                                              \
     ? (result_type)                                                         \
       RESULT_FAILURE(RESULT_USE_FAILURE(result))                            \
@@ -586,6 +1200,7 @@
 #define RESULT_MAP_FAILURE(result, failure_mapper, result_type)             \
   (                                                                         \
     (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(result_type)),                                  \
     RESULT_HAS_FAILURE(result)                                              \
     ? (result_type)                                                         \
       RESULT_FAILURE(failure_mapper(RESULT_USE_FAILURE(result)))            \
@@ -617,6 +1232,7 @@
 #define RESULT_MAP(result, success_mapper, failure_mapper, result_type)     \
   (                                                                         \
     (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(result_type)),                                  \
     RESULT_HAS_FAILURE(result)                                              \
     ? (result_type)                                                         \
       RESULT_FAILURE(failure_mapper(RESULT_USE_FAILURE(result)))            \
@@ -644,6 +1260,7 @@
 #define RESULT_FLAT_MAP_SUCCESS(result, success_mapper)                     \
   (                                                                         \
     (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(success_mapper(RESULT_USE_SUCCESS(result)))),   \
     RESULT_HAS_FAILURE(result)                                              \
     ? (typeof(success_mapper(RESULT_USE_SUCCESS(result))))                  \
       RESULT_FAILURE(RESULT_USE_FAILURE(result))                            \
@@ -670,6 +1287,7 @@
 #define RESULT_FLAT_MAP_FAILURE(result, failure_mapper)                     \
   (                                                                         \
     (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(failure_mapper(RESULT_USE_FAILURE(result)))),   \
     RESULT_HAS_FAILURE(result)                                              \
     ? (failure_mapper(RESULT_USE_FAILURE(result)))                          \
     : (typeof(failure_mapper(RESULT_USE_FAILURE(result))))                  \
@@ -697,80 +1315,217 @@
 #define RESULT_FLAT_MAP(result, success_mapper, failure_mapper)             \
   (                                                                         \
     (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(success_mapper(RESULT_USE_SUCCESS(result)))),   \
     RESULT_HAS_FAILURE(result)                                              \
     ? (failure_mapper(RESULT_USE_FAILURE(result)))                          \
     : (success_mapper(RESULT_USE_SUCCESS(result)))                          \
   )
 
-#ifndef NDEBUG
-
 /**
- * Returns the function name where a result was created.
+ * Transforms the value of a successful result in place.
+ *
+ * Unlike #RESULT_MAP_SUCCESS, no new result is created: @b success_mutator
+ * receives a pointer to @b result's success value and modifies it directly.
+ *
+ * @pre @b result MUST be a modifiable @e lvalue.
  *
  * @b Example:
- * @snippet example.c result_debug
+ * @snippet example.c result_map_success_in_place
  *
- * @param result The result to retrieve the debug information from.
- * @return The function name where @b result was created if @p NDEBUG is
- *   undefined; otherwise @p NULL.
+ * @param result The result whose success value will be transformed.
+ * @param success_mutator The function or macro to be applied to a pointer to
+ *   @b result's success value.
  *
- * @see RESULT_DEBUG_FILE
- * @see RESULT_DEBUG_LINE
+ * @see RESULT_MAP_FAILURE_IN_PLACE
+ * @see RESULT_MAP_IN_PLACE
  */
-#define RESULT_DEBUG_FUNC(result)                                           \
-  ((result)._debug._func)
-
-#else
+#define RESULT_MAP_SUCCESS_IN_PLACE(result, success_mutator)                \
+  do {                                                                      \
+    if (RESULT_HAS_SUCCESS(result)) {                                       \
+      (void) (success_mutator(&RESULT_USE_SUCCESS(result)));                \
+    }                                                                       \
+  } while(false)
 
 /**
- * Returns the function name where a result was created.
+ * Transforms the value of a failed result in place.
+ *
+ * Unlike #RESULT_MAP_FAILURE, no new result is created: @b failure_mutator
+ * receives a pointer to @b result's failure value and modifies it directly.
+ *
+ * @pre @b result MUST be a modifiable @e lvalue.
  *
  * @b Example:
- * @snippet example.c result_debug
+ * @snippet example.c result_map_failure_in_place
  *
- * @param result The result to retrieve the debug information from.
- * @return The function name where @b result was created if @p NDEBUG is
- *   undefined; otherwise @p NULL.
+ * @param result The result whose failure value will be transformed.
+ * @param failure_mutator The function or macro to be applied to a pointer to
+ *   @b result's failure value.
  *
- * @see RESULT_DEBUG_FILE
- * @see RESULT_DEBUG_LINE
+ * @see RESULT_MAP_SUCCESS_IN_PLACE
+ * @see RESULT_MAP_IN_PLACE
  */
-#define RESULT_DEBUG_FUNC(result)                                           \
-  (NULL)
-
-#endif
-
-#ifndef NDEBUG
+#define RESULT_MAP_FAILURE_IN_PLACE(result, failure_mutator)                \
+  do {                                                                      \
+    if (RESULT_HAS_FAILURE(result)) {                                       \
+      (void) (failure_mutator(&RESULT_USE_FAILURE(result)));                \
+    }                                                                       \
+  } while(false)
 
 /**
- * Returns the source file name where a result was created.
+ * Transforms either the success or the failure value of a result in place.
+ *
+ * Unlike #RESULT_MAP, no new result is created: the mutators receive a pointer
+ * to @b result's value and modify it directly.
+ *
+ * @pre @b result MUST be a modifiable @e lvalue.
  *
  * @b Example:
- * @snippet example.c result_debug
+ * @snippet example.c result_map_in_place
  *
- * @param result The result to retrieve the debug information from.
- * @return The source file name where @b result was created if @p NDEBUG is
- *   undefined; otherwise @p NULL.
+ * @param result The result whose value will be transformed.
+ * @param success_mutator The function or macro to be applied to a pointer to
+ *   @b result's success value.
+ * @param failure_mutator The function or macro to be applied to a pointer to
+ *   @b result's failure value.
  *
- * @see RESULT_DEBUG_FUNC
- * @see RESULT_DEBUG_LINE
+ * @see RESULT_MAP_SUCCESS_IN_PLACE
+ * @see RESULT_MAP_FAILURE_IN_PLACE
  */
-#define RESULT_DEBUG_FILE(result)                                           \
-  ((result)._debug._file)
-
-#else
+#define RESULT_MAP_IN_PLACE(result, success_mutator, failure_mutator)       \
+  do {                                                                      \
+    if (RESULT_HAS_FAILURE(result)) {                                       \
+      (void) (failure_mutator(&RESULT_USE_FAILURE(result)));                \
+    } else {                                                                \
+      (void) (success_mutator(&RESULT_USE_SUCCESS(result)));                \
+    }                                                                       \
+  } while(false)
 
 /**
- * Returns the source file name where a result was created.
+ * Fills a lookup table with the results of a function over a small key domain.
  *
- * @b Example:
- * @snippet example.c result_debug
+ * Each element of @b table is assigned the result of calling @b function with
+ * its own index, so that the table can later be read via #RESULT_TABLE_GET.
  *
- * @param result The result to retrieve the debug information from.
- * @return The source file name where @b result was created if @p NDEBUG is
- *   undefined; otherwise @p NULL.
+ * @pre @b table MUST be an array (not a pointer).
  *
- * @see RESULT_DEBUG_FUNC
+ * @remark
+ * Tables can also be precomputed at compile time via #RESULT_STATIC_SUCCESS
+ * and #RESULT_STATIC_FAILURE.
+ *
+ * @b Example:
+ * @snippet example.c result_table
+ *
+ * @param table The array of results to fill.
+ * @param function The function or macro that produces the result for a key.
+ *
+ * @see RESULT_TABLE_GET
+ */
+#define RESULT_TABLE_FILL(table, function)                                  \
+  do {                                                                      \
+    for (size_t _key = 0; _key < sizeof(table) / sizeof((table)[0]);        \
+         _key++) {                                                          \
+      (table)[_key] = (function(_key));                                     \
+    }                                                                       \
+  } while(false)
+
+/**
+ * Looks up a result in a table, falling back to a function outside of its key
+ * domain.
+ *
+ * Keys within the bounds of @b table are read with a single indexed load;
+ * negative or out-of-bounds keys are passed to @b function instead.
+ *
+ * @pre @b table MUST be an array (not a pointer).
+ * @pre @b key MUST NOT have side effects.
+ *
+ * @b Example:
+ * @snippet example.c result_table
+ *
+ * @param table The array of precomputed results.
+ * @param key The integer key to look up.
+ * @param function The function or macro that produces the result for keys
+ *   outside of the table.
+ * @return The result stored in @b table at index @b key if within bounds;
+ *   otherwise the result produced by @b function.
+ *
+ * @see RESULT_TABLE_FILL
+ */
+#define RESULT_TABLE_GET(table, key, function)                              \
+  (                                                                         \
+    (size_t) (key) < sizeof(table) / sizeof((table)[0])                     \
+    ? (table)[(size_t) (key)]                                               \
+    : (function(key))                                                       \
+  )
+
+#ifndef NDEBUG
+
+/**
+ * Returns the function name where a result was created.
+ *
+ * @b Example:
+ * @snippet example.c result_debug
+ *
+ * @param result The result to retrieve the debug information from.
+ * @return The function name where @b result was created if @p NDEBUG is
+ *   undefined; otherwise @p NULL.
+ *
+ * @see RESULT_DEBUG_FILE
+ * @see RESULT_DEBUG_LINE
+ */
+#define RESULT_DEBUG_FUNC(result)                                           \
+  RESULT_DEBUG_MEMBER(result, _func)
+
+#else
+
+/**
+ * Returns the function name where a result was created.
+ *
+ * @b Example:
+ * @snippet example.c result_debug
+ *
+ * @param result The result to retrieve the debug information from.
+ * @return The function name where @b result was created if @p NDEBUG is
+ *   undefined; otherwise @p NULL.
+ *
+ * @see RESULT_DEBUG_FILE
+ * @see RESULT_DEBUG_LINE
+ */
+#define RESULT_DEBUG_FUNC(result)                                           \
+  (NULL)
+
+#endif
+
+#ifndef NDEBUG
+
+/**
+ * Returns the source file name where a result was created.
+ *
+ * @b Example:
+ * @snippet example.c result_debug
+ *
+ * @param result The result to retrieve the debug information from.
+ * @return The source file name where @b result was created if @p NDEBUG is
+ *   undefined; otherwise @p NULL.
+ *
+ * @see RESULT_DEBUG_FUNC
+ * @see RESULT_DEBUG_LINE
+ */
+#define RESULT_DEBUG_FILE(result)                                           \
+  RESULT_DEBUG_MEMBER(result, _file)
+
+#else
+
+/**
+ * Returns the source file name where a result was created.
+ *
+ * @b Example:
+ * @snippet example.c result_debug
+ *
+ * @param result The result to retrieve the debug information from.
+ * @return The source file name where @b result was created if @p NDEBUG is
+ *   undefined; otherwise @p NULL.
+ *
+ * @see RESULT_DEBUG_FUNC
  * @see RESULT_DEBUG_LINE
  */
 #define RESULT_DEBUG_FILE(result)                                           \
@@ -794,7 +1549,7 @@
  * @see RESULT_DEBUG_FILE
  */
 #define RESULT_DEBUG_LINE(result)                                           \
-  ((result)._debug._line)
+  RESULT_DEBUG_MEMBER(result, _line)
 
 #else
 
@@ -835,6 +1590,23 @@
 #define RESULT_TAG(success_type_name, failure_type_name)                    \
   result_of_ ## success_type_name ## _and_ ## failure_type_name
 
+#ifndef RESULT_MAX_SIZE
+
+/**
+ * Returns the maximum size in bytes of result types.
+ *
+ * Result structs declared via #RESULT_STRUCT_TAG or #RESULT_STRUCT_VOID_TAG,
+ * and types registered via #RESULT_LAYOUT_REGISTER, are checked against this
+ * value at compile time. It may be overridden by defining `RESULT_MAX_SIZE`
+ * before including this header; for example, `16` keeps results within the
+ * two registers used to return small structs on x86-64 and AArch64.
+ *
+ * @see RESULT_STRUCT_TAG
+ */
+#define RESULT_MAX_SIZE SIZE_MAX
+
+#endif
+
 #ifndef NDEBUG
 
 /**
@@ -842,6 +1614,9 @@
  *
  * @pre @b struct_tag SHOULD be generated via #RESULT_TAG.
  *
+ * @note
+ * The size of the struct is checked against #RESULT_MAX_SIZE at compile time.
+ *
  * @warning
  * The exact sequence of members that make up a result struct MUST be considered
  * part of the implementation details. Results SHOULD only be created and
@@ -868,11 +1643,16 @@
       success_type _success;                                                \
       failure_type _failure;                                                \
     } _value;                                                               \
-    struct {                                                                \
-      const char * _func;                                                   \
-      const char * _file;                                                   \
-      int _line;                                                            \
-    } _debug;                                                               \
+    RESULT_DEBUG_INFO _debug;                                               \
+    _Static_assert(sizeof(struct {                                          \
+      bool _failed;                                                         \
+      union {                                                               \
+        success_type _success;                                              \
+        failure_type _failure;                                              \
+      } _value;                                                             \
+      RESULT_DEBUG_INFO _debug;                                             \
+    }) <= RESULT_MAX_SIZE,                                                  \
+      "Result struct " #struct_tag " exceeds RESULT_MAX_SIZE");             \
   }
 
 #else
@@ -882,6 +1662,9 @@
  *
  * @pre @b struct_tag SHOULD be generated via #RESULT_TAG.
  *
+ * @note
+ * The size of the struct is checked against #RESULT_MAX_SIZE at compile time.
+ *
  * @warning
  * The exact sequence of members that make up a result struct MUST be considered
  * part of the implementation details. Results SHOULD only be created and
@@ -908,7 +1691,1949 @@
       success_type _success;                                                \
       failure_type _failure;                                                \
     } _value;                                                               \
+    _Static_assert(sizeof(struct {                                          \
+      bool _failed;                                                         \
+      union {                                                               \
+        success_type _success;                                              \
+        failure_type _failure;                                              \
+      } _value;                                                             \
+    }) <= RESULT_MAX_SIZE,                                                  \
+      "Result struct " #struct_tag " exceeds RESULT_MAX_SIZE");             \
+  }
+
+#endif
+
+#ifndef RESULT_CLEAR_PADDING
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_clear_padding)
+
+/**
+ * Returns whether #RESULT_CLEAR_PADDING actually clears padding bytes.
+ *
+ * @see RESULT_CLEAR_PADDING
+ */
+#define RESULT_CLEARS_PADDING true
+
+/**
+ * Sets the padding bytes of an object to zero.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_LAYOUT_REGISTER and
+ * `result_wire.h`, and SHOULD NOT be used directly.
+ *
+ * @param object A pointer to the object.
+ */
+#define RESULT_CLEAR_PADDING(object)                                        \
+  __builtin_clear_padding(object)
+
+#endif
+#endif
+#endif
+
+#ifndef RESULT_CLEAR_PADDING
+
+/**
+ * Returns whether #RESULT_CLEAR_PADDING actually clears padding bytes.
+ *
+ * @see RESULT_CLEAR_PADDING
+ */
+#define RESULT_CLEARS_PADDING false
+
+/**
+ * Sets the padding bytes of an object to zero.
+ *
+ * The compiler does not provide `__builtin_clear_padding`, so padding bytes
+ * cannot be told apart from the other bytes of an object; this macro does
+ * nothing.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_LAYOUT_REGISTER and
+ * `result_wire.h`, and SHOULD NOT be used directly.
+ *
+ * @param object A pointer to the object.
+ */
+#define RESULT_CLEAR_PADDING(object)                                        \
+  ((void) (object))
+
+#endif
+
+#ifdef RESULT_LAYOUT_REGISTRY
+
+#include <stdio.h> /* FILE, fprintf */
+
+/**
+ * Represents the memory layout of a registered result type.
+ *
+ * When `RESULT_LAYOUT_REGISTRY` is defined before including this header, every
+ * type registered via #RESULT_LAYOUT_REGISTER emits one of these records into
+ * the `__result_layouts` linker section, so that they can be inspected at
+ * runtime via #result_layout_report.
+ *
+ * @note
+ * Every record has the same size and alignment, so the section can be walked
+ * as a plain array.
+ */
+struct result_layout {
+  _Alignas(32) const char * _name;
+  size_t (* _padding)(void);
+  uint32_t _size;
+  uint32_t _alignment;
+  uint32_t _value_offset;
+  uint32_t _debug_offset;
+};
+
+_Static_assert(sizeof(struct result_layout) == 32,
+  "Layout records must have a uniform stride");
+
+#ifndef NDEBUG
+
+/**
+ * Registers the layout of a result type.
+ *
+ * The size of @b type is checked against #RESULT_MAX_SIZE at compile time, and
+ * its layout is recorded so that it can be reported via #result_layout_report.
+ * Any kind of result type can be registered, including void, word-packed and
+ * thread-local results; NaN-boxed results are registered via
+ * #RESULT_LAYOUT_REGISTER_NAN.
+ *
+ * When `RESULT_LAYOUT_REGISTRY` is not defined, this macro does nothing.
+ *
+ * @pre This macro MUST be used at file scope.
+ *
+ * @param type The result type, such as `RESULT(int, char)`.
+ * @return The layout declarations.
+ */
+#define RESULT_LAYOUT_REGISTER(type)                                        \
+  RESULT_LAYOUT_EMIT(type, offsetof(type, _debug), __COUNTER__)
+
+#else
+
+/**
+ * Registers the layout of a result type.
+ *
+ * The size of @b type is checked against #RESULT_MAX_SIZE at compile time, and
+ * its layout is recorded so that it can be reported via #result_layout_report.
+ * Any kind of result type can be registered, including void, word-packed and
+ * thread-local results; NaN-boxed results are registered via
+ * #RESULT_LAYOUT_REGISTER_NAN.
+ *
+ * When `RESULT_LAYOUT_REGISTRY` is not defined, this macro does nothing.
+ *
+ * @pre This macro MUST be used at file scope.
+ *
+ * @param type The result type, such as `RESULT(int, char)`.
+ * @return The layout declarations.
+ */
+#define RESULT_LAYOUT_REGISTER(type)                                        \
+  RESULT_LAYOUT_EMIT(type, RESULT_LAYOUT_NO_DEBUG, __COUNTER__)
+
+#endif
+
+/**
+ * Registers the layout of a NaN-boxed result type.
+ *
+ * NaN-boxed results carry no debug information, so their debug offset is
+ * recorded as #RESULT_LAYOUT_NO_DEBUG.
+ *
+ * When `RESULT_LAYOUT_REGISTRY` is not defined, this macro does nothing.
+ *
+ * @pre This macro MUST be used at file scope.
+ *
+ * @param type The result type, such as `RESULT_NAN(char)`.
+ * @return The layout declarations.
+ *
+ * @see RESULT_LAYOUT_REGISTER
+ */
+#define RESULT_LAYOUT_REGISTER_NAN(type)                                    \
+  RESULT_LAYOUT_EMIT(type, RESULT_LAYOUT_NO_DEBUG, __COUNTER__)
+
+/**
+ * Returns the debug offset recorded for result types without debug
+ * information.
+ *
+ * @see result_layout_report
+ */
+#define RESULT_LAYOUT_NO_DEBUG UINT32_MAX
+
+/**
+ * Registers the layout of a result type under a unique identifier.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_LAYOUT_REGISTER and SHOULD
+ * NOT be used directly.
+ */
+#define RESULT_LAYOUT_EMIT(type, debug_offset, id)                          \
+  RESULT_LAYOUT_DECLARE(type, debug_offset, id)
+
+/**
+ * Declares the size check, padding counter and layout record of a result type.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_LAYOUT_REGISTER and SHOULD
+ * NOT be used directly.
+ */
+#define RESULT_LAYOUT_DECLARE(type, debug_offset, id)                       \
+  _Static_assert(sizeof(type) <= RESULT_MAX_SIZE,                           \
+    "Result type " #type " exceeds RESULT_MAX_SIZE");                       \
+  static size_t result_layout_padding_ ## id(void) {                        \
+    type value;                                                             \
+    memset(&value, 0xFF, sizeof(value));                                    \
+    RESULT_CLEAR_PADDING(&value);                                           \
+    return result_layout_zero_bytes(&value, sizeof(value));                 \
+  }                                                                         \
+  static const struct result_layout result_layout_ ## id                    \
+    __attribute__((section("__result_layouts"), used)) = {                  \
+      ._name = #type,                                                       \
+      ._padding = result_layout_padding_ ## id,                             \
+      ._size = sizeof(type),                                                \
+      ._alignment = _Alignof(type),                                         \
+      ._value_offset = offsetof(type, _value),                              \
+      ._debug_offset = (debug_offset)                                       \
+    }
+
+/**
+ * Counts the zero bytes of an object.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_LAYOUT_REGISTER and
+ * SHOULD NOT be called directly.
+ *
+ * @param object The object.
+ * @param size The size of the object.
+ * @return The number of zero bytes.
+ */
+static inline size_t result_layout_zero_bytes(const void * object,
+    size_t size) {
+  const unsigned char * bytes = object;
+  size_t count = 0;
+  for (size_t index = 0; index < size; index++) {
+    count += bytes[index] == 0;
+  }
+  return count;
+}
+
+/**
+ * The first layout record, provided by the linker.
+ *
+ * @warning
+ * This variable is an implementation detail of #result_layout_report and
+ * SHOULD NOT be accessed directly.
+ */
+extern const struct result_layout __start___result_layouts[]
+  __attribute__((weak));
+
+/**
+ * One past the last layout record, provided by the linker.
+ *
+ * @warning
+ * This variable is an implementation detail of #result_layout_report and
+ * SHOULD NOT be accessed directly.
+ */
+extern const struct result_layout __stop___result_layouts[]
+  __attribute__((weak));
+
+/**
+ * Prints the registered result types that are larger than the supplied size or
+ * contain padding bytes.
+ *
+ * Each line shows the type, its size and alignment, the offsets of its value
+ * and its debug information, and the number of padding bytes. Types without
+ * debug information show `-` instead of an offset. Padding bytes are found by
+ * the compiler, so they are counted correctly for every kind of result type;
+ * when the compiler cannot find them (see #RESULT_CLEARS_PADDING), they are
+ * not counted. Types registered in several source files are listed once.
+ *
+ * @note
+ * This function is only available when `RESULT_LAYOUT_REGISTRY` is defined.
+ *
+ * @param stream The output stream.
+ * @param max_size The size above which a type is reported.
+ * @return The number of reported types.
+ */
+static inline size_t result_layout_report(FILE * stream, size_t max_size) {
+  size_t count = 0;
+  for (const struct result_layout * layout = __start___result_layouts;
+      layout != __stop___result_layouts; layout++) {
+    const struct result_layout * previous = __start___result_layouts;
+    while (previous != layout && strcmp(previous->_name, layout->_name) != 0) {
+      previous++;
+    }
+    if (previous != layout) {
+      continue;
+    }
+    const size_t padding = layout->_padding();
+    if (layout->_size <= max_size && padding == 0) {
+      continue;
+    }
+    (void) fprintf(stream, "%s: size %u, align %u, value @%u, debug ",
+      layout->_name, (unsigned) layout->_size, (unsigned) layout->_alignment,
+      (unsigned) layout->_value_offset);
+    if (layout->_debug_offset == RESULT_LAYOUT_NO_DEBUG) {
+      (void) fprintf(stream, "-, padding %zu\n", padding);
+    } else {
+      (void) fprintf(stream, "@%u, padding %zu\n",
+        (unsigned) layout->_debug_offset, padding);
+    }
+    count++;
   }
+  return count;
+}
+
+#else
+
+/**
+ * Registers the layout of a result type.
+ *
+ * When `RESULT_LAYOUT_REGISTRY` is not defined, this macro does nothing.
+ *
+ * @param type The result type, such as `RESULT(int, char)`.
+ * @return An empty declaration.
+ */
+#define RESULT_LAYOUT_REGISTER(type)                                        \
+  _Static_assert(true, "Layout registry disabled")
+
+/**
+ * Registers the layout of a NaN-boxed result type.
+ *
+ * When `RESULT_LAYOUT_REGISTRY` is not defined, this macro does nothing.
+ *
+ * @param type The result type, such as `RESULT_NAN(char)`.
+ * @return An empty declaration.
+ */
+#define RESULT_LAYOUT_REGISTER_NAN(type)                                    \
+  _Static_assert(true, "Layout registry disabled")
+
+#endif
+
+#ifndef RESULT_REGISTER_RETURN_SIZE
+
+#if defined(__x86_64__) || defined(__aarch64__)
+
+/**
+ * Returns the maximum size in bytes of structs returned in registers.
+ *
+ * On x86-64 System V and AArch64 AAPCS, structs of up to 16 bytes are returned
+ * in a pair of registers (`RAX:RDX` or `X0:X1`); larger structs are returned
+ * through memory provided by the caller. On other targets, no limit is
+ * assumed. This value may be overridden by defining
+ * `RESULT_REGISTER_RETURN_SIZE` before including this header.
+ *
+ * @see RESULT_ASSERT_REGISTER_RETURN
+ */
+#define RESULT_REGISTER_RETURN_SIZE 16
+
+#else
+
+/**
+ * Returns the maximum size in bytes of structs returned in registers.
+ *
+ * On x86-64 System V and AArch64 AAPCS, structs of up to 16 bytes are returned
+ * in a pair of registers (`RAX:RDX` or `X0:X1`); larger structs are returned
+ * through memory provided by the caller. On other targets, no limit is
+ * assumed. This value may be overridden by defining
+ * `RESULT_REGISTER_RETURN_SIZE` before including this header.
+ *
+ * @see RESULT_ASSERT_REGISTER_RETURN
+ */
+#define RESULT_REGISTER_RETURN_SIZE SIZE_MAX
+
+#endif
+
+#endif
+
+#if defined(NDEBUG) || defined(RESULT_STRICT_REGISTER_RETURN)
+
+/**
+ * Asserts at compile time that results of the supplied type are returned in
+ * registers.
+ *
+ * Debug information makes results larger, so this assertion is only checked
+ * when `NDEBUG` is defined, unless `RESULT_STRICT_REGISTER_RETURN` is defined
+ * before including this header, in which case it is checked in every build.
+ *
+ * @note
+ * Only the size of the type is checked. Results whose value types contain
+ * `long double` or other members that the ABI classifies as memory may still
+ * be returned through memory.
+ *
+ * @b Example:
+ * @snippet example.c result_assert_register_return
+ *
+ * @param type The result type.
+ * @return The static assertion.
+ *
+ * @see RESULT_REGISTER_RETURN_SIZE
+ */
+#define RESULT_ASSERT_REGISTER_RETURN(type)                                 \
+  _Static_assert(sizeof(type) <= RESULT_REGISTER_RETURN_SIZE,               \
+    "Result type " #type " is returned through memory")
+
+#else
+
+/**
+ * Asserts at compile time that results of the supplied type are returned in
+ * registers.
+ *
+ * Debug information makes results larger, so this assertion is only checked
+ * when `NDEBUG` is defined, unless `RESULT_STRICT_REGISTER_RETURN` is defined
+ * before including this header, in which case it is checked in every build.
+ *
+ * @note
+ * Only the size of the type is checked. Results whose value types contain
+ * `long double` or other members that the ABI classifies as memory may still
+ * be returned through memory.
+ *
+ * @b Example:
+ * @snippet example.c result_assert_register_return
+ *
+ * @param type The result type.
+ * @return The static assertion.
+ *
+ * @see RESULT_REGISTER_RETURN_SIZE
+ */
+#define RESULT_ASSERT_REGISTER_RETURN(type)                                 \
+  _Static_assert(sizeof(type) > 0,                                          \
+    "Result type " #type " is incomplete")
+
+#endif
+
+/**
+ * Returns the type specifier for results with no success value and the supplied
+ * failure type name.
+ *
+ * For example, a result that can either succeed with no value or hold a
+ * @p char failure value, has a type specifier:
+ * <tt>struct result_of_void_and_char</tt>.
+ *
+ * @note
+ * The struct tag will be generated via #RESULT_TAG.
+ *
+ * @remark
+ * Results without success values are useful for operations that can only
+ * succeed or fail, such as validations or writes. They can be checked via
+ * #RESULT_HAS_SUCCESS and #RESULT_HAS_FAILURE, and their failure values can be
+ * accessed via #RESULT_USE_FAILURE, #RESULT_GET_FAILURE and #RESULT_IF_FAILURE.
+ *
+ * @b Example:
+ * @snippet example.c result_void
+ *
+ * @param failure_type_name The failure type name.
+ * @return The result type specifier.
+ *
+ * @see RESULT_STRUCT_VOID
+ */
+#define RESULT_VOID(failure_type_name)                                      \
+  RESULT(void, failure_type_name)
+
+/**
+ * Declares a result struct with a default tag, no success value and the
+ * supplied failure type.
+ *
+ * @note
+ * The struct tag will be generated via #RESULT_TAG.
+ *
+ * @remark
+ * This macro is useful to declare result structs for operations that can only
+ * succeed or fail. When @p NDEBUG is defined and the failure type fits in four
+ * bytes, these results fit in a single register.
+ *
+ * @b Example:
+ * @snippet example.c result_void
+ *
+ * @param failure_type The failure type.
+ * @return The type definition.
+ *
+ * @see RESULT_VOID
+ */
+#define RESULT_STRUCT_VOID(failure_type)                                    \
+  RESULT_STRUCT_VOID_TAG(                                                   \
+    failure_type,                                                           \
+    RESULT_TAG(void, failure_type)                                          \
+  )
+
+#ifndef NDEBUG
+
+/**
+ * Initializes a new successful result with no success value.
+ *
+ * @b Example:
+ * @snippet example.c result_void
+ *
+ * @return The initializer for a successful result with no success value.
+ *
+ * @see RESULT_VOID
+ * @see RESULT_FAILURE
+ */
+#define RESULT_VOID_SUCCESS()                                               \
+  {                                                                         \
+    ._failed = false,                                                       \
+    ._debug = RESULT_DEBUG_HERE                                             \
+  }
+
+#else
+
+/**
+ * Initializes a new successful result with no success value.
+ *
+ * @b Example:
+ * @snippet example.c result_void
+ *
+ * @return The initializer for a successful result with no success value.
+ *
+ * @see RESULT_VOID
+ * @see RESULT_FAILURE
+ */
+#define RESULT_VOID_SUCCESS()                                               \
+  {                                                                         \
+    ._failed = false                                                        \
+  }
+
+#endif
+
+/**
+ * Transforms the value of a failed result with no success value.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c result_void_map_failure
+ *
+ * @param result The result whose failure value will be transformed.
+ * @param failure_mapper The mapping function or macro that produces the new
+ *   failure value.
+ * @param result_type The type of transformed result type.
+ * @return If @b result is failed, a new failed result holding the value
+ *   produced by @b failure_mapper; otherwise, a new successful result with no
+ *   success value.
+ *
+ * @see RESULT_MAP_FAILURE
+ */
+#define RESULT_VOID_MAP_FAILURE(result, failure_mapper, result_type)        \
+  (                                                                         \
+    (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(result_type)),                                  \
+    RESULT_HAS_FAILURE(result)                                              \
+    ? (result_type)                                                         \
+      RESULT_FAILURE(failure_mapper(RESULT_USE_FAILURE(result)))            \
+    : (result_type)                                                         \
+      RESULT_VOID_SUCCESS()                                                 \
+  )
+
+#ifndef NDEBUG
+
+/**
+ * Declares a result struct with no success value and the supplied failure type.
+ *
+ * @pre @b struct_tag SHOULD be generated via #RESULT_TAG.
+ *
+ * @note
+ * The size of the struct is checked against #RESULT_MAX_SIZE at compile time.
+ *
+ * @warning
+ * The exact sequence of members that make up a result struct MUST be considered
+ * part of the implementation details. Results SHOULD only be created and
+ * accessed using the macros provided in this header file.
+ *
+ * @remark
+ * This macro is useful to declare result structs for operations that can only
+ * succeed or fail.
+ *
+ * @b Example:
+ * @snippet example.c result_void
+ *
+ * @param failure_type The failure type.
+ * @param struct_tag The struct tag.
+ * @return The struct declaration.
+ *
+ * @see RESULT_STRUCT_VOID
+ * @see RESULT_TAG
+ */
+#define RESULT_STRUCT_VOID_TAG(failure_type, struct_tag)                    \
+  struct struct_tag {                                                       \
+    bool _failed;                                                           \
+    union {                                                                 \
+      failure_type _failure;                                                \
+    } _value;                                                               \
+    RESULT_DEBUG_INFO _debug;                                               \
+    _Static_assert(sizeof(struct {                                          \
+      bool _failed;                                                         \
+      union {                                                               \
+        failure_type _failure;                                              \
+      } _value;                                                             \
+      RESULT_DEBUG_INFO _debug;                                             \
+    }) <= RESULT_MAX_SIZE,                                                  \
+      "Result struct " #struct_tag " exceeds RESULT_MAX_SIZE");             \
+  }
+
+#else
+
+/**
+ * Declares a result struct with no success value and the supplied failure type.
+ *
+ * @pre @b struct_tag SHOULD be generated via #RESULT_TAG.
+ *
+ * @note
+ * The size of the struct is checked against #RESULT_MAX_SIZE at compile time.
+ *
+ * @warning
+ * The exact sequence of members that make up a result struct MUST be considered
+ * part of the implementation details. Results SHOULD only be created and
+ * accessed using the macros provided in this header file.
+ *
+ * @remark
+ * This macro is useful to declare result structs for operations that can only
+ * succeed or fail.
+ *
+ * @b Example:
+ * @snippet example.c result_void
+ *
+ * @param failure_type The failure type.
+ * @param struct_tag The struct tag.
+ * @return The struct declaration.
+ *
+ * @see RESULT_STRUCT_VOID
+ * @see RESULT_TAG
+ */
+#define RESULT_STRUCT_VOID_TAG(failure_type, struct_tag)                    \
+  struct struct_tag {                                                       \
+    bool _failed;                                                           \
+    union {                                                                 \
+      failure_type _failure;                                                \
+    } _value;                                                               \
+    _Static_assert(sizeof(struct {                                          \
+      bool _failed;                                                         \
+      union {                                                               \
+        failure_type _failure;                                              \
+      } _value;                                                             \
+    }) <= RESULT_MAX_SIZE,                                                  \
+      "Result struct " #struct_tag " exceeds RESULT_MAX_SIZE");             \
+  }
+
+#endif
+
+/**
+ * Declares a word-packed result struct with a default tag and the supplied
+ * success and failure types.
+ *
+ * Word-packed results keep the success or failure value and the discriminant in
+ * a single 64-bit word, so they are passed and returned in one register and can
+ * be loaded and stored atomically via #RESULT_PACKED64_LOAD and
+ * #RESULT_PACKED64_STORE. They are created and accessed with the same macros as
+ * regular results.
+ *
+ * @pre Both @b success_type and @b failure_type MUST NOT be larger than 32
+ *   bits.
+ *
+ * @note
+ * The struct tag will be generated via #RESULT_TAG.
+ *
+ * @b Example:
+ * @snippet example.c result_packed64
+ *
+ * @param success_type The success type.
+ * @param failure_type The failure type.
+ * @return The type definition.
+ *
+ * @see RESULT_STRUCT
+ */
+#define RESULT_STRUCT_PACKED64(success_type, failure_type)                  \
+  RESULT_STRUCT_PACKED64_TAG(                                               \
+    success_type,                                                           \
+    failure_type,                                                           \
+    RESULT_TAG(success_type, failure_type)                                  \
+  )
+
+/**
+ * Atomically loads a word-packed result.
+ *
+ * @note
+ * Debug information is not loaded.
+ *
+ * @b Example:
+ * @snippet example.c result_packed64
+ *
+ * @param pointer The pointer to the word-packed result to load.
+ * @return A copy of the word-packed result pointed to by @b pointer.
+ *
+ * @see RESULT_PACKED64_STORE
+ */
+#define RESULT_PACKED64_LOAD(pointer)                                       \
+  ((typeof(*(pointer))) {                                                   \
+    ._word = __atomic_load_n(&(pointer)->_word, __ATOMIC_ACQUIRE)           \
+  })
+
+/**
+ * Atomically stores a word-packed result.
+ *
+ * @note
+ * Debug information is not stored.
+ *
+ * @b Example:
+ * @snippet example.c result_packed64
+ *
+ * @param pointer The pointer to the word-packed result to overwrite.
+ * @param result The word-packed result to store.
+ *
+ * @see RESULT_PACKED64_LOAD
+ */
+#define RESULT_PACKED64_STORE(pointer, result)                              \
+  __atomic_store_n(&(pointer)->_word, (result)._word, __ATOMIC_RELEASE)
+
+#ifndef NDEBUG
+
+/**
+ * Declares a word-packed result struct with the supplied success and failure
+ * types.
+ *
+ * @pre Both @b success_type and @b failure_type MUST NOT be larger than 32
+ *   bits.
+ * @pre @b struct_tag SHOULD be generated via #RESULT_TAG.
+ *
+ * @warning
+ * The exact sequence of members that make up a result struct MUST be considered
+ * part of the implementation details. Results SHOULD only be created and
+ * accessed using the macros provided in this header file.
+ *
+ * @b Example:
+ * @snippet example.c result_packed64
+ *
+ * @param success_type The success type.
+ * @param failure_type The failure type.
+ * @param struct_tag The struct tag.
+ * @return The struct declaration.
+ *
+ * @see RESULT_STRUCT_PACKED64
+ * @see RESULT_TAG
+ */
+#define RESULT_STRUCT_PACKED64_TAG(success_type, failure_type, struct_tag)  \
+  struct struct_tag {                                                       \
+    union {                                                                 \
+      uint64_t _word;                                                       \
+      struct {                                                              \
+        bool _failed;                                                       \
+        union {                                                             \
+          success_type _success;                                            \
+          failure_type _failure;                                            \
+        } _value;                                                           \
+      };                                                                    \
+    };                                                                      \
+    RESULT_DEBUG_INFO _debug;                                               \
+    _Static_assert(                                                         \
+      sizeof(success_type) <= sizeof(uint32_t)                              \
+        && sizeof(failure_type) <= sizeof(uint32_t),                        \
+      "Word-packed success and failure types must not exceed 32 bits"       \
+    );                                                                      \
+  }
+
+#else
+
+/**
+ * Declares a word-packed result struct with the supplied success and failure
+ * types.
+ *
+ * @pre Both @b success_type and @b failure_type MUST NOT be larger than 32
+ *   bits.
+ * @pre @b struct_tag SHOULD be generated via #RESULT_TAG.
+ *
+ * @warning
+ * The exact sequence of members that make up a result struct MUST be considered
+ * part of the implementation details. Results SHOULD only be created and
+ * accessed using the macros provided in this header file.
+ *
+ * @b Example:
+ * @snippet example.c result_packed64
+ *
+ * @param success_type The success type.
+ * @param failure_type The failure type.
+ * @param struct_tag The struct tag.
+ * @return The struct declaration.
+ *
+ * @see RESULT_STRUCT_PACKED64
+ * @see RESULT_TAG
+ */
+#define RESULT_STRUCT_PACKED64_TAG(success_type, failure_type, struct_tag)  \
+  struct struct_tag {                                                       \
+    union {                                                                 \
+      uint64_t _word;                                                       \
+      struct {                                                              \
+        bool _failed;                                                       \
+        union {                                                             \
+          success_type _success;                                            \
+          failure_type _failure;                                            \
+        } _value;                                                           \
+      };                                                                    \
+    };                                                                      \
+    _Static_assert(                                                         \
+      sizeof(success_type) <= sizeof(uint32_t)                              \
+        && sizeof(failure_type) <= sizeof(uint32_t),                        \
+      "Word-packed success and failure types must not exceed 32 bits"       \
+    );                                                                      \
+  }
+
+#endif
+
+/**
+ * Returns the type specifier for options with the supplied value type name.
+ *
+ * Options are a compact companion to results for operations that have a single
+ * reason to fail. For example, an option that may hold an @p int value, has a
+ * type specifier: <tt>struct option_of_int</tt>.
+ *
+ * @note
+ * The struct tag will be generated via #OPTION_TAG.
+ *
+ * @b Example:
+ * @snippet example.c option
+ *
+ * @param value_type_name The value type name.
+ * @return The option type specifier.
+ *
+ * @see OPTION_STRUCT
+ * @see OPTION_STRUCT_POINTER
+ */
+#define OPTION(value_type_name)                                             \
+  struct OPTION_TAG(value_type_name)
+
+/**
+ * Declares an option struct with a default tag and the supplied value type.
+ *
+ * @note
+ * The struct tag will be generated via #OPTION_TAG.
+ *
+ * @b Example:
+ * @snippet example.c option
+ *
+ * @param value_type The value type.
+ * @return The type definition.
+ *
+ * @see OPTION
+ * @see OPTION_STRUCT_POINTER
+ */
+#define OPTION_STRUCT(value_type)                                           \
+  OPTION_STRUCT_TAG(value_type, OPTION_TAG(value_type))
+
+/**
+ * Declares an option struct with a default tag and the supplied pointer type.
+ *
+ * Pointer options use the null pointer to represent the absence of a value, so
+ * they are exactly as large as the pointer itself.
+ *
+ * @note
+ * The struct tag will be generated via #OPTION_TAG.
+ *
+ * @b Example:
+ * @snippet example.c option
+ *
+ * @param pointer_type The pointer value type.
+ * @return The type definition.
+ *
+ * @see OPTION
+ * @see OPTION_STRUCT
+ */
+#define OPTION_STRUCT_POINTER(pointer_type)                                 \
+  OPTION_STRUCT_POINTER_TAG(pointer_type, OPTION_TAG(pointer_type))
+
+/**
+ * Initializes a new option containing the supplied value.
+ *
+ * @pre The option MUST have been declared via #OPTION_STRUCT. Pointer options
+ *   MUST be initialized via #OPTION_SOME_POINTER instead.
+ *
+ * @b Example:
+ * @snippet example.c option_some
+ *
+ * @param value The value.
+ * @return The initializer for an option holding @b value.
+ *
+ * @see OPTION_SOME_POINTER
+ * @see OPTION_NONE
+ */
+#define OPTION_SOME(value)                                                  \
+  {                                                                         \
+    ._present = true,                                                       \
+    ._value = (value)                                                       \
+  }
+
+/**
+ * Initializes a new pointer option containing the supplied value.
+ *
+ * Only the pointer is initialized, since the presence flag shares storage with
+ * it.
+ *
+ * @pre The option MUST have been declared via #OPTION_STRUCT_POINTER.
+ * @pre @b value MUST NOT be a null pointer.
+ *
+ * @b Example:
+ * @snippet example.c option
+ *
+ * @param value The pointer value.
+ * @return The initializer for a pointer option holding @b value.
+ *
+ * @see OPTION_SOME
+ * @see OPTION_NONE
+ */
+#define OPTION_SOME_POINTER(value)                                          \
+  {                                                                         \
+    ._value = (value)                                                       \
+  }
+
+/**
+ * Initializes a new empty option.
+ *
+ * @b Example:
+ * @snippet example.c option
+ *
+ * @return The initializer for an empty option.
+ *
+ * @see OPTION_SOME
+ */
+#define OPTION_NONE()                                                       \
+  {                                                                         \
+    ._present = false                                                       \
+  }
+
+/**
+ * Checks if an option contains a value.
+ *
+ * @b Example:
+ * @snippet example.c option
+ *
+ * @param option The option to check.
+ * @return @p true if @b option contains a value; otherwise @p false.
+ *
+ * @see OPTION_IS_EMPTY
+ */
+#define OPTION_HAS_VALUE(option)                                            \
+  (!!(option)._present)
+
+/**
+ * Checks if an option is empty.
+ *
+ * @b Example:
+ * @snippet example.c option
+ *
+ * @param option The option to check.
+ * @return @p true if @b option is empty; otherwise @p false.
+ *
+ * @see OPTION_HAS_VALUE
+ */
+#define OPTION_IS_EMPTY(option)                                             \
+  (!(option)._present)
+
+/**
+ * Returns an option's value.
+ *
+ * @pre @b option MUST contain a value.
+ *
+ * @b Example:
+ * @snippet example.c option
+ *
+ * @param option The option to retrieve the value from.
+ * @return @b option's value.
+ *
+ * @see OPTION_OR_ELSE
+ */
+#define OPTION_USE_VALUE(option)                                            \
+  ((option)._value)
+
+/**
+ * Returns an option's value, or the supplied one.
+ *
+ * @pre @b option MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c option_or_else
+ *
+ * @param option The option to retrieve the value from.
+ * @param other The alternative value.
+ * @return @b option's value if present; otherwise @b other.
+ *
+ * @see OPTION_USE_VALUE
+ */
+#define OPTION_OR_ELSE(option, other)                                       \
+  (                                                                         \
+    (void) &(option),                                                       \
+    OPTION_HAS_VALUE(option)                                                \
+    ? OPTION_USE_VALUE(option)                                              \
+    : (other)                                                               \
+  )
+
+/**
+ * Stores a value into an option.
+ *
+ * @warning
+ * This function is an implementation detail of #OPTION_MAP and
+ * #OPTION_FROM_RESULT and SHOULD NOT be called directly.
+ *
+ * @param option The option.
+ * @param offset The offset of the value within the option.
+ * @param value The value.
+ * @param size The size of the value.
+ * @return The option.
+ */
+static inline void * option_store(void * option, size_t offset,
+    const void * value, size_t size) {
+  memcpy((char *) option + offset, value, size);
+  return option;
+}
+
+/**
+ * Creates a new option of the supplied type containing the supplied value.
+ *
+ * The presence flag is set before the value is stored, so that the value
+ * overwrites it when both share storage, and an option can be created without
+ * knowing whether it was declared via #OPTION_STRUCT or #OPTION_STRUCT_POINTER.
+ * The value is converted to the value type of the option first.
+ *
+ * @warning
+ * This macro is an implementation detail and SHOULD NOT be used directly.
+ *
+ * @param option_type The type of the option.
+ * @param value The value.
+ * @return A new option holding @b value.
+ */
+#define OPTION_WRAP(option_type, value)                                     \
+  (*(option_type *) option_store(                                           \
+    &(option_type) {._present = true},                                      \
+    offsetof(option_type, _value),                                          \
+    (typeof(((option_type *) 0)->_value) []) {(value)},                     \
+    sizeof(((option_type *) 0)->_value)))
+
+/**
+ * Transforms the value of an option.
+ *
+ * @pre @b option MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c option_map
+ *
+ * @param option The option whose value will be transformed.
+ * @param mapper The mapping function or macro that produces the new value.
+ * @param option_type The type of transformed option.
+ * @return If @b option contains a value, a new option holding the value
+ *   produced by @b mapper; otherwise, a new empty option.
+ *
+ * @see OPTION_FLAT_MAP
+ */
+#define OPTION_MAP(option, mapper, option_type)                             \
+  (                                                                         \
+    (void) &(option),                                                       \
+    OPTION_HAS_VALUE(option)                                                \
+    ? OPTION_WRAP(option_type, mapper(OPTION_USE_VALUE(option)))            \
+    : (option_type) OPTION_NONE()                                           \
+  )
+
+/**
+ * Transforms an option into a different one.
+ *
+ * @pre @b option MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c option_flat_map
+ *
+ * @param option The option that will be transformed.
+ * @param mapper The mapping function or macro that produces the new option.
+ * @return If @b option contains a value, the option produced by @b mapper;
+ *   otherwise, a new empty option.
+ *
+ * @see OPTION_MAP
+ */
+#define OPTION_FLAT_MAP(option, mapper)                                     \
+  (                                                                         \
+    (void) &(option),                                                       \
+    OPTION_HAS_VALUE(option)                                                \
+    ? (mapper(OPTION_USE_VALUE(option)))                                    \
+    : (typeof(mapper(OPTION_USE_VALUE(option)))) OPTION_NONE()              \
+  )
+
+/**
+ * Conditionally transforms an option into an empty one.
+ *
+ * @pre @b option MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c option_filter
+ *
+ * @param option The option to filter.
+ * @param is_acceptable The predicate function or macro to apply to the value.
+ * @return If @b option contains a value that is deemed not acceptable, a new
+ *   empty option; otherwise, the supplied @b option.
+ */
+#define OPTION_FILTER(option, is_acceptable)                                \
+  (                                                                         \
+    (void) &(option),                                                       \
+    OPTION_IS_EMPTY(option)                                                 \
+            || (is_acceptable(OPTION_USE_VALUE(option)))                    \
+    ? (option)                                                              \
+    : (typeof(option)) OPTION_NONE()                                        \
+  )
+
+/**
+ * Converts a result into an option, discarding its failure value.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c option_from_result
+ *
+ * @param result The result to convert.
+ * @param option_type The type of the option.
+ * @return If @b result is successful, a new option holding its success value;
+ *   otherwise, a new empty option.
+ *
+ * @see RESULT_FROM_OPTION
+ */
+#define OPTION_FROM_RESULT(result, option_type)                             \
+  (                                                                         \
+    (void) &(result),                                                       \
+    RESULT_HAS_FAILURE(result)                                              \
+    ? (option_type) OPTION_NONE()                                           \
+    : OPTION_WRAP(option_type, RESULT_USE_SUCCESS(result))                  \
+  )
+
+/**
+ * Converts an option into a result.
+ *
+ * @pre @b option MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c result_from_option
+ *
+ * @param option The option to convert.
+ * @param failure The failure value if @b option is empty.
+ * @param result_type The type of the result.
+ * @return If @b option contains a value, a new successful result holding it;
+ *   otherwise, a new failed result holding @b failure.
+ *
+ * @see OPTION_FROM_RESULT
+ */
+#define RESULT_FROM_OPTION(option, failure, result_type)                    \
+  (                                                                         \
+    (void) &(option),                                                       \
+    OPTION_HAS_VALUE(option)                                                \
+    ? (result_type) RESULT_SUCCESS(OPTION_USE_VALUE(option))                \
+    : (result_type) RESULT_FAILURE(failure)                                 \
+  )
+
+/**
+ * Returns the struct tag for options with the supplied value type name.
+ *
+ * For example, an option that may hold an @p int value, has a struct tag:
+ * @p option_of_int.
+ *
+ * @param value_type_name The value type name.
+ * @return The option struct tag.
+ *
+ * @see OPTION_STRUCT_TAG
+ * @see OPTION_STRUCT_POINTER_TAG
+ */
+#define OPTION_TAG(value_type_name)                                         \
+  option_of_ ## value_type_name
+
+/**
+ * Declares an option struct with the supplied value type.
+ *
+ * @pre @b struct_tag SHOULD be generated via #OPTION_TAG.
+ *
+ * @warning
+ * The exact sequence of members that make up an option struct MUST be
+ * considered part of the implementation details. Options SHOULD only be created
+ * and accessed using the macros provided in this header file.
+ *
+ * @param value_type The value type.
+ * @param struct_tag The struct tag.
+ * @return The struct declaration.
+ *
+ * @see OPTION_STRUCT
+ * @see OPTION_TAG
+ */
+#define OPTION_STRUCT_TAG(value_type, struct_tag)                           \
+  struct struct_tag {                                                       \
+    bool _present;                                                          \
+    value_type _value;                                                      \
+  }
+
+/**
+ * Declares an option struct with the supplied pointer type.
+ *
+ * The presence flag shares storage with the pointer value, so that null
+ * pointers represent empty options.
+ *
+ * @pre @b struct_tag SHOULD be generated via #OPTION_TAG.
+ *
+ * @warning
+ * The exact sequence of members that make up an option struct MUST be
+ * considered part of the implementation details. Options SHOULD only be created
+ * and accessed using the macros provided in this header file.
+ *
+ * @param pointer_type The pointer value type.
+ * @param struct_tag The struct tag.
+ * @return The struct declaration.
+ *
+ * @see OPTION_STRUCT_POINTER
+ * @see OPTION_TAG
+ */
+#define OPTION_STRUCT_POINTER_TAG(pointer_type, struct_tag)                 \
+  struct struct_tag {                                                       \
+    union {                                                                 \
+      pointer_type _value;                                                  \
+      uintptr_t _present;                                                   \
+    };                                                                      \
+  }
+
+/**
+ * Returns the type specifier for NaN-boxed results with a @p double success
+ * value and the supplied failure type name.
+ *
+ * NaN-boxed results are exactly as large as a @p double: failures are encoded
+ * as quiet NaN payloads that cannot be produced by floating-point arithmetic.
+ * Arrays of NaN-boxed results can be processed as plain @p double arrays, and
+ * on most hardware failures propagate through arithmetic like any other NaN.
+ *
+ * For example, a NaN-boxed result that can hold either a @p double success
+ * value or an @p int failure value, has a type specifier:
+ * <tt>struct result_nan_of_int</tt>.
+ *
+ * @note
+ * The struct tag will be generated via #RESULT_NAN_TAG.
+ *
+ * @warning
+ * NaN-boxed results don't record debug information.
+ *
+ * @b Example:
+ * @snippet example.c result_nan
+ *
+ * @param failure_type_name The failure type name.
+ * @return The NaN-boxed result type specifier.
+ *
+ * @see RESULT_STRUCT_NAN
+ */
+#define RESULT_NAN(failure_type_name)                                       \
+  struct RESULT_NAN_TAG(failure_type_name)
+
+/**
+ * Declares a NaN-boxed result struct with a default tag, a @p double success
+ * type and the supplied failure type.
+ *
+ * @pre @b failure_type MUST be an integer or enumeration type no larger than
+ *   32 bits.
+ *
+ * @note
+ * The struct tag will be generated via #RESULT_NAN_TAG.
+ *
+ * @b Example:
+ * @snippet example.c result_nan
+ *
+ * @param failure_type The failure type.
+ * @return The type definition.
+ *
+ * @see RESULT_NAN
+ */
+#define RESULT_STRUCT_NAN(failure_type)                                     \
+  RESULT_STRUCT_NAN_TAG(failure_type, RESULT_NAN_TAG(failure_type))
+
+/**
+ * The smallest bit pattern of a NaN-boxed failure.
+ *
+ * Failures are encoded as this bit pattern, which is a negative quiet NaN
+ * whose payload has bit 48 set, with the failure value in its low 32 bits. Any
+ * bit pattern at or above this value is a failure, including negative quiet
+ * NaNs with payload bit 49 or 50 set. The default NaNs generated by x86-64 and
+ * AArch64 hardware are lower than this value, so they remain successful.
+ */
+#define RESULT_NAN_FAILURE_BITS                                             \
+  UINT64_C(0xFFF9000000000000)
+
+/**
+ * Initializes a new successful NaN-boxed result containing the supplied value.
+ *
+ * @pre The bit pattern of @b success MUST be below #RESULT_NAN_FAILURE_BITS;
+ *   that is, it MUST NOT be a negative quiet NaN with any of payload bits 48
+ *   to 50 set.
+ *
+ * @b Example:
+ * @snippet example.c result_nan
+ *
+ * @param success The @p double success value.
+ * @return The initializer for a successful NaN-boxed result holding
+ *   @b success.
+ *
+ * @see RESULT_NAN_FAILURE
+ */
+#define RESULT_NAN_SUCCESS(success)                                         \
+  {                                                                         \
+    ._value = {                                                             \
+      ._success = (success)                                                 \
+    }                                                                       \
+  }
+
+/**
+ * Initializes a new failed NaN-boxed result containing the supplied value.
+ *
+ * @b Example:
+ * @snippet example.c result_nan
+ *
+ * @param failure The failure value.
+ * @return The initializer for a failed NaN-boxed result holding @b failure.
+ *
+ * @see RESULT_NAN_SUCCESS
+ */
+#define RESULT_NAN_FAILURE(failure)                                         \
+  {                                                                         \
+    ._value = {                                                             \
+      ._bits = RESULT_NAN_FAILURE_BITS | (uint32_t) (failure)               \
+    }                                                                       \
+  }
+
+/**
+ * Checks if a NaN-boxed result contains a success value.
+ *
+ * @b Example:
+ * @snippet example.c result_nan
+ *
+ * @param result The NaN-boxed result to check for success.
+ * @return @p true if @b result is successful; otherwise @p false.
+ *
+ * @see RESULT_NAN_HAS_FAILURE
+ */
+#define RESULT_NAN_HAS_SUCCESS(result)                                      \
+  ((result)._value._bits < RESULT_NAN_FAILURE_BITS)
+
+/**
+ * Checks if a NaN-boxed result contains a failure value.
+ *
+ * @b Example:
+ * @snippet example.c result_nan
+ *
+ * @param result The NaN-boxed result to check for failure.
+ * @return @p true if @b result is failed; otherwise @p false.
+ *
+ * @see RESULT_NAN_HAS_SUCCESS
+ */
+#define RESULT_NAN_HAS_FAILURE(result)                                      \
+  ((result)._value._bits >= RESULT_NAN_FAILURE_BITS)
+
+/**
+ * Returns a NaN-boxed result's success value.
+ *
+ * @pre @b result SHOULD be successful.
+ *
+ * @remark
+ * If @b result is failed, a NaN is returned.
+ *
+ * @b Example:
+ * @snippet example.c result_nan
+ *
+ * @param result The NaN-boxed result to retrieve the success value from.
+ * @return @b result's success value.
+ *
+ * @see RESULT_NAN_USE_FAILURE
+ */
+#define RESULT_NAN_USE_SUCCESS(result)                                      \
+  ((result)._value._success)
+
+/**
+ * Returns a NaN-boxed result's failure value.
+ *
+ * @pre @b result MUST be failed.
+ *
+ * @b Example:
+ * @snippet example.c result_nan
+ *
+ * @param result The NaN-boxed result to retrieve the failure value from.
+ * @return @b result's failure value.
+ *
+ * @see RESULT_NAN_USE_SUCCESS
+ */
+#define RESULT_NAN_USE_FAILURE(result)                                      \
+  ((typeof((result)._value._failure)) (uint32_t) (result)._value._bits)
+
+/**
+ * Returns a NaN-boxed result's success value, or the supplied one.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c result_nan
+ *
+ * @param result The NaN-boxed result to retrieve the success value from.
+ * @param other The alternative success value.
+ * @return @b result's success value if successful; otherwise @b other.
+ *
+ * @see RESULT_OR_ELSE
+ */
+#define RESULT_NAN_OR_ELSE(result, other)                                   \
+  (                                                                         \
+    (void) &(result),                                                       \
+    RESULT_NAN_HAS_FAILURE(result)                                          \
+    ? (other)                                                               \
+    : RESULT_NAN_USE_SUCCESS(result)                                        \
+  )
+
+/**
+ * Returns the struct tag for NaN-boxed results with the supplied failure type
+ * name.
+ *
+ * For example, a NaN-boxed result that can hold an @p int failure value, has a
+ * struct tag: @p result_nan_of_int.
+ *
+ * @param failure_type_name The failure type name.
+ * @return The NaN-boxed result struct tag.
+ *
+ * @see RESULT_STRUCT_NAN_TAG
+ */
+#define RESULT_NAN_TAG(failure_type_name)                                   \
+  result_nan_of_ ## failure_type_name
+
+/**
+ * Declares a NaN-boxed result struct with a @p double success type and the
+ * supplied failure type.
+ *
+ * @pre @b failure_type MUST be an integer or enumeration type no larger than
+ *   32 bits.
+ * @pre @b struct_tag SHOULD be generated via #RESULT_NAN_TAG.
+ *
+ * @warning
+ * The exact sequence of members that make up a result struct MUST be considered
+ * part of the implementation details. Results SHOULD only be created and
+ * accessed using the macros provided in this header file.
+ *
+ * @param failure_type The failure type.
+ * @param struct_tag The struct tag.
+ * @return The struct declaration.
+ *
+ * @see RESULT_STRUCT_NAN
+ * @see RESULT_NAN_TAG
+ */
+#define RESULT_STRUCT_NAN_TAG(failure_type, struct_tag)                     \
+  struct struct_tag {                                                       \
+    union {                                                                 \
+      double _success;                                                      \
+      uint64_t _bits;                                                       \
+      failure_type _failure;                                                \
+    } _value;                                                               \
+    _Static_assert(                                                         \
+      sizeof(failure_type) <= sizeof(uint32_t),                             \
+      "NaN-boxed failure types must not be larger than 32 bits"             \
+    );                                                                      \
+  }
+
+/**
+ * Returns the type specifier for results with the supplied success type name
+ * and boxed failures of the supplied failure type name.
+ *
+ * Boxed results hold a pointer to a failure value stored in a #RESULT_ARENA,
+ * so their size is driven by the success type alone, no matter how large the
+ * failure type is. They are regular results whose failure type is
+ * `const failure_type *`, so all macros that work with results also work with
+ * boxed results.
+ *
+ * @b Example:
+ * @snippet example.c result_boxed
+ *
+ * @param success_type_name The success type name.
+ * @param failure_type_name The failure type name.
+ * @return The type specifier.
+ *
+ * @see RESULT_STRUCT_BOXED
+ */
+#define RESULT_BOXED(success_type_name, failure_type_name)                  \
+  RESULT(success_type_name, boxed_ ## failure_type_name)
+
+/**
+ * Declares a result struct with the supplied success type and boxed failures
+ * of the supplied failure type.
+ *
+ * @b Example:
+ * @snippet example.c result_boxed
+ *
+ * @param success_type The success type.
+ * @param failure_type The failure type.
+ * @return The type definition.
+ *
+ * @see RESULT_BOXED
+ */
+#define RESULT_STRUCT_BOXED(success_type, failure_type)                     \
+  RESULT_STRUCT_TAG(                                                        \
+    success_type,                                                           \
+    const failure_type *,                                                   \
+    RESULT_TAG(success_type, boxed_ ## failure_type)                        \
+  )
+
+/**
+ * Returns the type specifier for arenas with the supplied capacity.
+ *
+ * Arenas provide storage for boxed failure values. They are typically declared
+ * as static or thread-local variables and reset via #RESULT_ARENA_RESET once
+ * the boxed failures are no longer needed.
+ *
+ * @b Example:
+ * @snippet example.c result_boxed
+ *
+ * @param capacity The arena capacity in bytes.
+ * @return The type specifier.
+ *
+ * @see RESULT_BOX
+ */
+#define RESULT_ARENA(capacity)                                              \
+  struct {                                                                  \
+    size_t _used;                                                           \
+    _Alignas(max_align_t) unsigned char _bytes[capacity];                   \
+  }
+
+/**
+ * Releases all values boxed in an arena.
+ *
+ * @warning
+ * Pointers previously returned by #RESULT_BOX for this arena MUST NOT be used
+ * after the arena has been reset.
+ *
+ * @b Example:
+ * @snippet example.c result_boxed
+ *
+ * @param arena The arena to reset.
+ *
+ * @see RESULT_ARENA
+ */
+#define RESULT_ARENA_RESET(arena) ((arena)._used = 0)
+
+/**
+ * Copies a value into an arena.
+ *
+ * @note
+ * If the arena is exhausted, the value is not copied and `NULL` is returned.
+ * Boxed failures SHOULD be created via #RESULT_BOX_FAILURE, which falls back
+ * to a static failure instead.
+ *
+ * @param arena The arena to copy the value into.
+ * @param value The value to copy.
+ * @return A pointer to the copied value, or `NULL`.
+ *
+ * @see RESULT_ARENA
+ * @see RESULT_BOX_FAILURE
+ */
+#define RESULT_BOX(arena, value)                                            \
+  ((typeof(value) *) result_box(                                            \
+    (arena)._bytes,                                                         \
+    sizeof((arena)._bytes),                                                 \
+    &(arena)._used,                                                         \
+    &(struct { typeof(value) _boxed; }) { ._boxed = (value) }._boxed,       \
+    sizeof(value),                                                          \
+    _Alignof(typeof(value))                                                 \
+  ))
+
+/**
+ * Initializes a new failed result containing a boxed copy of the supplied
+ * failure value.
+ *
+ * If the arena is exhausted, the result holds @b fallback instead, so boxed
+ * failures never hold a null pointer.
+ *
+ * @pre @b fallback MUST point to a failure value that outlives the result,
+ *   such as a static constant.
+ *
+ * @b Example:
+ * @snippet example.c result_boxed
+ *
+ * @param arena The arena to copy the failure value into.
+ * @param failure The failure value.
+ * @param fallback A pointer to the failure value to use if @b arena is full.
+ * @return The initializer for a failed boxed result.
+ *
+ * @see RESULT_BOX
+ */
+#define RESULT_BOX_FAILURE(arena, failure, fallback)                        \
+  RESULT_FAILURE((typeof(fallback)) result_box_or(                          \
+    RESULT_BOX(arena, failure), (fallback)))
+
+/**
+ * Returns a boxed value, or the supplied fallback if it could not be boxed.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_BOX_FAILURE and SHOULD
+ * NOT be called directly.
+ *
+ * @param boxed The boxed value, or `NULL`.
+ * @param fallback The fallback value.
+ * @return @b boxed if it is not `NULL`; otherwise, @b fallback.
+ */
+static inline const void * result_box_or(const void * boxed,
+    const void * fallback) {
+  return boxed != NULL ? boxed : fallback;
+}
+
+/**
+ * Copies a value into a byte buffer.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_BOX and SHOULD NOT be
+ * called directly.
+ *
+ * @param bytes The byte buffer.
+ * @param capacity The byte buffer capacity.
+ * @param used The number of bytes already used.
+ * @param value The value to copy.
+ * @param size The value size.
+ * @param alignment The value alignment.
+ * @return A pointer to the copied value, or `NULL`.
+ */
+static inline void * result_box(unsigned char * bytes, size_t capacity,
+    size_t * used, const void * value, size_t size, size_t alignment) {
+  const size_t offset = (*used + alignment - 1) & ~(alignment - 1);
+  if (offset > capacity || size > capacity - offset) {
+    return NULL;
+  }
+  *used = offset + size;
+  return memcpy(bytes + offset, value, size);
+}
+
+/**
+ * A node in a failure context chain.
+ *
+ * Context nodes are allocated in a #RESULT_ARENA by #RESULT_WRAP_FAILURE and
+ * accessed via #RESULT_CONTEXT_MESSAGE and #RESULT_CONTEXT_CAUSE.
+ *
+ * @see RESULT_USE_CONTEXT
+ */
+struct result_context {
+  const char * _message;
+  const struct result_context * _cause;
+};
+
+/**
+ * Returns the type specifier for contextual failures with the supplied root
+ * failure type name.
+ *
+ * Contextual failures hold a root failure value and a chain of context
+ * messages, added via #RESULT_WRAP_FAILURE as the failure crosses layers.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param failure_type_name The root failure type name.
+ * @return The type specifier.
+ *
+ * @see RESULT_STRUCT_CONTEXT
+ */
+#define RESULT_CONTEXT(failure_type_name)                                   \
+  struct result_context_of_ ## failure_type_name
+
+/**
+ * Declares a contextual failure struct with the supplied root failure type.
+ *
+ * @warning
+ * The exact sequence of members that make up a contextual failure struct MUST
+ * be considered part of the implementation details. Contextual failures SHOULD
+ * only be created and accessed using the macros provided in this header file.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param failure_type The root failure type.
+ * @return The struct declaration.
+ *
+ * @see RESULT_CONTEXT
+ */
+#define RESULT_STRUCT_CONTEXT(failure_type)                                 \
+  RESULT_CONTEXT(failure_type) {                                            \
+    failure_type _root;                                                     \
+    const struct result_context * _context;                                 \
+  }
+
+/**
+ * Returns the type specifier for results with the supplied success type name
+ * and contextual failures of the supplied root failure type name.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param success_type_name The success type name.
+ * @param failure_type_name The root failure type name.
+ * @return The type specifier.
+ *
+ * @see RESULT_STRUCT_CONTEXTUAL
+ */
+#define RESULT_CONTEXTUAL(success_type_name, failure_type_name)             \
+  RESULT(success_type_name, context_of_ ## failure_type_name)
+
+/**
+ * Declares a result struct with the supplied success type and contextual
+ * failures of the supplied root failure type.
+ *
+ * @pre The contextual failure type MUST have been declared via
+ *   #RESULT_STRUCT_CONTEXT.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param success_type The success type.
+ * @param failure_type The root failure type.
+ * @return The type definition.
+ *
+ * @see RESULT_CONTEXTUAL
+ */
+#define RESULT_STRUCT_CONTEXTUAL(success_type, failure_type)                \
+  RESULT_STRUCT_TAG(                                                        \
+    success_type,                                                           \
+    RESULT_CONTEXT(failure_type),                                           \
+    RESULT_TAG(success_type, context_of_ ## failure_type)                   \
+  )
+
+#ifndef NDEBUG
+
+/**
+ * Initializes a new result containing a contextual failure with no context.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param root_failure The root failure value.
+ * @return A new result containing the supplied root failure value.
+ *
+ * @see RESULT_WRAP_FAILURE
+ */
+#define RESULT_CONTEXT_FAILURE(root_failure)                                \
+  {                                                                         \
+    ._failed = true,                                                        \
+    ._value = {                                                             \
+      ._failure = {                                                         \
+        ._root = (root_failure),                                            \
+        ._context = NULL                                                    \
+      }                                                                     \
+    },                                                                      \
+    ._debug = RESULT_DEBUG_HERE                                             \
+  }
+
+/**
+ * Adds a context message to a failed result.
+ *
+ * The new context node is allocated in @b arena in constant time and no memory
+ * is ever freed: the whole chain is released at once via #RESULT_ARENA_RESET.
+ * Typically, a thread-local arena is reset when a unit of work has completed.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ *
+ * @note
+ * If @b arena is exhausted, @b message is dropped and the existing context
+ * chain is preserved. The debug information of @b result is preserved too, so
+ * that it keeps pointing at the root failure.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param arena The arena to allocate the context node in.
+ * @param result The result to add the context message to.
+ * @param message The context message.
+ * @return If @b result is failed, a new failed result holding the same root
+ *   failure value and the new context message; otherwise, the supplied
+ *   @b result.
+ *
+ * @see RESULT_USE_CONTEXT
+ */
+#define RESULT_WRAP_FAILURE(arena, result, message)                         \
+  (                                                                         \
+    (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(result)),                                       \
+    RESULT_HAS_FAILURE(result)                                              \
+    ? (typeof(result)) {                                                    \
+      ._failed = true,                                                      \
+      ._value = {                                                           \
+        ._failure = {                                                       \
+          ._root = RESULT_USE_ROOT_FAILURE(result),                         \
+          ._context = result_context_wrap(                                  \
+            (arena)._bytes,                                                 \
+            sizeof((arena)._bytes),                                         \
+            &(arena)._used,                                                 \
+            (message),                                                      \
+            RESULT_USE_CONTEXT(result)                                      \
+          )                                                                 \
+        }                                                                   \
+      },                                                                    \
+      ._debug = (result)._debug                                             \
+    }                                                                       \
+    : (result)                                                              \
+  )
+
+#else
+
+/**
+ * Initializes a new result containing a contextual failure with no context.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param root_failure The root failure value.
+ * @return A new result containing the supplied root failure value.
+ *
+ * @see RESULT_WRAP_FAILURE
+ */
+#define RESULT_CONTEXT_FAILURE(root_failure)                                \
+  {                                                                         \
+    ._failed = true,                                                        \
+    ._value = {                                                             \
+      ._failure = {                                                         \
+        ._root = (root_failure),                                            \
+        ._context = NULL                                                    \
+      }                                                                     \
+    }                                                                       \
+  }
+
+/**
+ * Adds a context message to a failed result.
+ *
+ * The new context node is allocated in @b arena in constant time and no memory
+ * is ever freed: the whole chain is released at once via #RESULT_ARENA_RESET.
+ * Typically, a thread-local arena is reset when a unit of work has completed.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ *
+ * @note
+ * If @b arena is exhausted, @b message is dropped and the existing context
+ * chain is preserved.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param arena The arena to allocate the context node in.
+ * @param result The result to add the context message to.
+ * @param message The context message.
+ * @return If @b result is failed, a new failed result holding the same root
+ *   failure value and the new context message; otherwise, the supplied
+ *   @b result.
+ *
+ * @see RESULT_USE_CONTEXT
+ */
+#define RESULT_WRAP_FAILURE(arena, result, message)                         \
+  (                                                                         \
+    (void) &(result),                                                       \
+    RESULT_COPY_HOOK(sizeof(result)),                                       \
+    RESULT_HAS_FAILURE(result)                                              \
+    ? (typeof(result)) {                                                    \
+      ._failed = true,                                                      \
+      ._value = {                                                           \
+        ._failure = {                                                       \
+          ._root = RESULT_USE_ROOT_FAILURE(result),                         \
+          ._context = result_context_wrap(                                  \
+            (arena)._bytes,                                                 \
+            sizeof((arena)._bytes),                                         \
+            &(arena)._used,                                                 \
+            (message),                                                      \
+            RESULT_USE_CONTEXT(result)                                      \
+          )                                                                 \
+        }                                                                   \
+      }                                                                     \
+    }                                                                       \
+    : (result)                                                              \
+  )
+
+#endif
+
+/**
+ * Returns the root failure value of a result containing a contextual failure.
+ *
+ * @pre @b result MUST be failed.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param result The result to extract the root failure value from.
+ * @return The root failure value.
+ *
+ * @see RESULT_USE_CONTEXT
+ */
+#define RESULT_USE_ROOT_FAILURE(result)                                     \
+  (RESULT_USE_FAILURE(result)._root)
+
+/**
+ * Returns the outermost context node of a result containing a contextual
+ * failure.
+ *
+ * @pre @b result MUST be failed.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param result The result to extract the context from.
+ * @return The outermost context node, or `NULL` if there is no context.
+ *
+ * @see RESULT_CONTEXT_MESSAGE
+ * @see RESULT_CONTEXT_CAUSE
+ */
+#define RESULT_USE_CONTEXT(result)                                          \
+  (RESULT_USE_FAILURE(result)._context)
+
+/**
+ * Returns the message of a context node.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param context The context node.
+ * @return The context message.
+ *
+ * @see RESULT_CONTEXT_CAUSE
+ */
+#define RESULT_CONTEXT_MESSAGE(context)                                     \
+  ((context)->_message)
+
+/**
+ * Returns the next inner node of a context node.
+ *
+ * @b Example:
+ * @snippet example.c result_context
+ *
+ * @param context The context node.
+ * @return The next inner context node, or `NULL` if @b context is the
+ *   innermost one.
+ *
+ * @see RESULT_CONTEXT_MESSAGE
+ */
+#define RESULT_CONTEXT_CAUSE(context)                                       \
+  ((context)->_cause)
+
+/**
+ * Allocates a context node in a byte buffer.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_WRAP_FAILURE and SHOULD
+ * NOT be called directly.
+ *
+ * @param bytes The byte buffer.
+ * @param capacity The byte buffer capacity.
+ * @param used The number of bytes already used.
+ * @param message The context message.
+ * @param cause The next inner context node.
+ * @return A pointer to the new context node, or @b cause if there is no room.
+ */
+static inline const struct result_context * result_context_wrap(
+    unsigned char * bytes, size_t capacity, size_t * used, const char * message,
+    const struct result_context * cause) {
+  const struct result_context context = {
+    ._message = message,
+    ._cause = cause
+  };
+  const struct result_context * wrapped = result_box(
+    bytes, capacity, used, &context, sizeof(context),
+    _Alignof(struct result_context));
+  return wrapped != NULL ? wrapped : cause;
+}
+
+#ifndef RESULT_COPY_HOOK
+
+/**
+ * Counts a result materialized by a macro.
+ *
+ * In copy-count mode, enabled by including `result_copy.h` before this header,
+ * every macro that materializes a result counts the copy against its call
+ * site. Otherwise, this macro does nothing.
+ *
+ * @warning
+ * This macro is an implementation detail of copy-count mode and SHOULD NOT be
+ * used directly.
+ *
+ * @param bytes The size of the materialized result.
+ */
+#define RESULT_COPY_HOOK(bytes) ((void) 0)
 
 #endif
 
@@ -0,0 +1,252 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Copy counting.
+ *
+ * This optional header enables copy-count mode, in which every macro that
+ * materializes a result counts the copy and its size against its call site.
+ * The heaviest call sites can then be retrieved via #result_copy_rank or
+ * printed via #result_copy_report.
+ *
+ * Copy-count mode applies to the whole source file, so this header MUST be
+ * included before `result.h` and any other optional header.
+ *
+ * ```c
+ * #include <result_copy.h>
+ * ```
+ *
+ * @file        result_copy.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_COPY_H
+#define RESULT_COPY_H
+
+#ifdef RESULT_VERSION
+#error "result_copy.h must be included before result.h"
+#endif
+
+#include <stddef.h> /* size_t */
+#include <stdio.h> /* FILE, fprintf */
+
+#ifndef RESULT_COPY_SITES
+
+/**
+ * Returns the maximum number of call sites tracked in copy-count mode.
+ *
+ * This value may be overridden by defining `RESULT_COPY_SITES` before
+ * including this header. It MUST be the same in every source file. Call sites
+ * beyond this limit are not ranked, but they are reported by
+ * #result_copy_untracked.
+ *
+ * @see result_copy_report
+ */
+#define RESULT_COPY_SITES 1024
+
+#endif
+
+/**
+ * Copy statistics of a single call site.
+ *
+ * @see result_copy_rank
+ */
+struct result_copy_site {
+  /** The call site, formatted as `file:line`. */
+  const char * site;
+  /** The number of results materialized at the call site. */
+  unsigned long long copies;
+  /** The total number of bytes materialized at the call site. */
+  unsigned long long bytes;
+};
+
+/**
+ * The call sites that materialized at least one result, in order of first use.
+ *
+ * The table is a weak definition, so that the linker merges the copies emitted
+ * by every source file that includes this header into a single one.
+ *
+ * @warning
+ * This variable is an implementation detail of copy-count mode and SHOULD NOT
+ * be accessed directly.
+ */
+__attribute__((weak))
+struct result_copy_site * result_copy_sites[RESULT_COPY_SITES] = {0};
+
+/**
+ * The number of call sites that materialized at least one result.
+ *
+ * @warning
+ * This variable is an implementation detail of copy-count mode and SHOULD NOT
+ * be accessed directly.
+ */
+__attribute__((weak)) size_t result_copy_site_count = 0;
+
+/**
+ * Counts a result materialized at the supplied call site.
+ *
+ * The first copy made at a call site adds it to the table of call sites.
+ *
+ * @warning
+ * This function is an implementation detail of copy-count mode and SHOULD NOT
+ * be called directly.
+ *
+ * @param site The statistics of the call site.
+ * @param bytes The size of the materialized result.
+ */
+static inline void result_copy_count(struct result_copy_site * site,
+    size_t bytes) {
+  if (__atomic_fetch_add(&site->copies, 1, __ATOMIC_RELAXED) == 0) {
+    const size_t index = __atomic_fetch_add(&result_copy_site_count, 1,
+      __ATOMIC_RELAXED);
+    if (index < RESULT_COPY_SITES) {
+      __atomic_store_n(&result_copy_sites[index], site, __ATOMIC_RELEASE);
+    }
+  }
+  (void) __atomic_add_fetch(&site->bytes, bytes, __ATOMIC_RELAXED);
+}
+
+/**
+ * Returns the number of call sites that did not fit in the table.
+ *
+ * @return The number of call sites beyond #RESULT_COPY_SITES, whose copies are
+ *   neither ranked nor reported.
+ *
+ * @see result_copy_rank
+ */
+static inline size_t result_copy_untracked(void) {
+  const size_t count = __atomic_load_n(&result_copy_site_count,
+    __ATOMIC_RELAXED);
+  return count > RESULT_COPY_SITES ? count - RESULT_COPY_SITES : 0;
+}
+
+/**
+ * Retrieves the call sites that materialized the most bytes, heaviest first.
+ *
+ * @param sites The array to store the call sites into.
+ * @param capacity The maximum number of call sites to retrieve.
+ * @return The number of call sites stored into @b sites.
+ *
+ * @see result_copy_report
+ */
+static inline size_t result_copy_rank(struct result_copy_site * sites,
+    size_t capacity) {
+  size_t count = 0;
+  for (size_t index = 0; index < RESULT_COPY_SITES; index++) {
+    const struct result_copy_site * site = __atomic_load_n(
+      &result_copy_sites[index], __ATOMIC_ACQUIRE);
+    if (site == NULL) {
+      continue;
+    }
+    const struct result_copy_site entry = {
+      .site = site->site,
+      .copies = __atomic_load_n(&site->copies, __ATOMIC_RELAXED),
+      .bytes = __atomic_load_n(&site->bytes, __ATOMIC_RELAXED)
+    };
+    size_t position = count < capacity ? count++ : capacity;
+    while (position > 0 && sites[position - 1].bytes < entry.bytes) {
+      if (position < capacity) {
+        sites[position] = sites[position - 1];
+      }
+      position--;
+    }
+    if (position < capacity) {
+      sites[position] = entry;
+    }
+  }
+  return count;
+}
+
+/**
+ * Prints the call sites that materialized the most bytes, heaviest first.
+ *
+ * If some call sites did not fit in the table, the report ends with a line
+ * telling how many.
+ *
+ * @b Example:
+ * @snippet copy-report.c result_copy_report
+ *
+ * @param stream The stream to print the report to.
+ * @param limit The maximum number of call sites to print.
+ *
+ * @see result_copy_rank
+ */
+static inline void result_copy_report(FILE * stream, size_t limit) {
+  struct result_copy_site sites[RESULT_COPY_SITES];
+  const size_t count = result_copy_rank(
+    sites, limit < RESULT_COPY_SITES ? limit : RESULT_COPY_SITES);
+  const size_t untracked = result_copy_untracked();
+  (void) fprintf(stream, "%12s %14s  %s\n", "copies", "bytes", "site");
+  for (size_t index = 0; index < count; index++) {
+    (void) fprintf(stream, "%12llu %14llu  %s\n",
+      sites[index].copies, sites[index].bytes, sites[index].site);
+  }
+  if (untracked > 0) {
+    (void) fprintf(stream, "untracked call sites: %zu (RESULT_COPY_SITES is"
+      " %zu)\n", untracked, (size_t) RESULT_COPY_SITES);
+  }
+}
+
+/**
+ * Returns the call site of a macro invocation on the supplied line.
+ *
+ * @warning
+ * This macro is an implementation detail of copy-count mode and SHOULD NOT be
+ * used directly.
+ */
+#define RESULT_COPY_SITE(line) RESULT_COPY_SITE_STRING(line)
+
+/**
+ * Returns the call site of a macro invocation on the supplied line number.
+ *
+ * @warning
+ * This macro is an implementation detail of copy-count mode and SHOULD NOT be
+ * used directly.
+ */
+#define RESULT_COPY_SITE_STRING(line) __FILE__ ":" #line
+
+/**
+ * Counts a result materialized by a macro.
+ *
+ * Every expansion owns a static #result_copy_site, so call sites are told
+ * apart without comparing strings, even when they are on the same line.
+ *
+ * @warning
+ * This macro is an implementation detail of copy-count mode and SHOULD NOT be
+ * used directly.
+ *
+ * @param bytes The size of the materialized result.
+ *
+ * @see result_copy_report
+ */
+#define RESULT_COPY_HOOK(bytes)                                             \
+  __extension__ ({                                                          \
+    static struct result_copy_site _copy_site = {                           \
+      .site = RESULT_COPY_SITE(__LINE__)                                    \
+    };                                                                      \
+    result_copy_count(&_copy_site, (bytes));                                \
+  })
+
+#include <result.h>
+
+#endif
@@ -0,0 +1,278 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Result-returning POSIX I/O.
+ *
+ * This optional header wraps the POSIX calls that report failures by returning
+ * a sentinel and setting `errno`, so that they return results instead. The
+ * failure value is the `errno` code, as an #io_error.
+ *
+ * ```c
+ * #include <result_io.h>
+ * ```
+ *
+ * The wrappers are `static inline` functions that make the same system calls
+ * as the raw functions would on their success path, except that transfers
+ * resume short reads and writes; see #io_read.
+ *
+ * @file        result_io.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_IO_H
+#define RESULT_IO_H
+
+#include <errno.h> /* errno, EINTR */
+#include <fcntl.h> /* open */
+#include <sys/mman.h> /* mmap, MAP_FAILED */
+#include <sys/stat.h> /* fstat, struct stat */
+#include <sys/types.h> /* off_t, ssize_t */
+#include <unistd.h> /* read, write, pread */
+#include <result.h>
+
+/**
+ * Represents an I/O failure as an `errno` code.
+ */
+typedef int io_error;
+
+/**
+ * Represents the status of a file.
+ */
+typedef struct stat io_stat;
+
+/**
+ * Represents the address of a memory mapping.
+ */
+typedef void * io_pointer;
+
+RESULT_STRUCT(int, io_error);
+
+RESULT_STRUCT(ssize_t, io_error);
+
+RESULT_STRUCT(io_pointer, io_error);
+
+RESULT_STRUCT(io_stat, io_error);
+
+RESULT_STRUCT_VOID(io_error);
+
+/**
+ * Converts the return value of a function that reports failures via `errno`
+ * into a result.
+ *
+ * @pre @b value MUST be an @e lvalue.
+ *
+ * @b Example:
+ * @snippet example.c result_from_errno
+ *
+ * @param value The return value to convert.
+ * @param sentinel The return value that signals a failure.
+ * @param result_type The type of the result.
+ * @return If @b value equals @b sentinel, a new failed result holding `errno`;
+ *   otherwise, a new successful result holding @b value.
+ */
+#define RESULT_FROM_ERRNO(value, sentinel, result_type)                     \
+  (                                                                         \
+    (void) &(value),                                                        \
+    (value) == (sentinel)                                                   \
+    ? (result_type) RESULT_FAILURE(errno)                                   \
+    : (result_type) RESULT_SUCCESS(value)                                   \
+  )
+
+/**
+ * Opens a file.
+ *
+ * Calls interrupted by a signal are retried.
+ *
+ * @param path The path of the file.
+ * @param flags The file access mode and creation flags.
+ * @param mode The permissions of the file, if it is created.
+ * @return A successful result holding the file descriptor, or a failed result
+ *   holding the `errno` code.
+ */
+static inline RESULT(int, io_error) io_open(const char * path, int flags,
+    mode_t mode) {
+  int descriptor;
+  do {
+    descriptor = open(path, flags, mode);
+  } while (descriptor == -1 && errno == EINTR);
+  return RESULT_FROM_ERRNO(descriptor, -1, RESULT(int, io_error));
+}
+
+/**
+ * Reads from a file descriptor until the buffer is full or the end of the file
+ * is reached.
+ *
+ * Calls interrupted by a signal are retried, and short reads are resumed. When
+ * fewer than @p count bytes are read, `errno` tells why: it is `0` if the end
+ * of the file was reached, or the code of the call that failed after some
+ * bytes were read, which are still reported as a success.
+ *
+ * @note
+ * Since the end of a file is only detected by a read that returns no bytes,
+ * reading a file that is shorter than the buffer makes one more system call
+ * than a single raw read would.
+ *
+ * @warning
+ * Since short reads are resumed, this function may block on pipes and sockets
+ * until @p count bytes arrive or the peer closes the connection.
+ *
+ * @param descriptor The file descriptor.
+ * @param buffer The buffer to read into.
+ * @param count The number of bytes to read.
+ * @return A successful result holding the number of bytes read, or a failed
+ *   result holding the `errno` code.
+ *
+ * @see io_pread
+ */
+static inline RESULT(ssize_t, io_error) io_read(int descriptor,
+    void * buffer, size_t count) {
+  ssize_t total = 0;
+  errno = 0;
+  while ((size_t) total < count) {
+    const ssize_t bytes = read(descriptor, (char *) buffer + total,
+      count - (size_t) total);
+    if (bytes > 0) {
+      total += bytes;
+    } else if (bytes == 0 || errno != EINTR) {
+      total = total > 0 ? total : bytes;
+      break;
+    } else {
+      errno = 0;
+    }
+  }
+  return RESULT_FROM_ERRNO(total, -1, RESULT(ssize_t, io_error));
+}
+
+/**
+ * Reads from a file descriptor at the supplied offset until the buffer is full
+ * or the end of the file is reached.
+ *
+ * Calls interrupted by a signal are retried, and short reads are resumed. When
+ * fewer than @p count bytes are read, `errno` tells why: it is `0` if the end
+ * of the file was reached, or the code of the call that failed after some
+ * bytes were read, which are still reported as a success.
+ *
+ * @note
+ * Since the end of a file is only detected by a read that returns no bytes,
+ * reading a file that is shorter than the buffer makes one more system call
+ * than a single raw read would.
+ *
+ * @param descriptor The file descriptor.
+ * @param buffer The buffer to read into.
+ * @param count The number of bytes to read.
+ * @param offset The file offset to read from.
+ * @return A successful result holding the number of bytes read, or a failed
+ *   result holding the `errno` code.
+ *
+ * @see io_read
+ */
+static inline RESULT(ssize_t, io_error) io_pread(int descriptor,
+    void * buffer, size_t count, off_t offset) {
+  ssize_t total = 0;
+  errno = 0;
+  while ((size_t) total < count) {
+    const ssize_t bytes = pread(descriptor, (char *) buffer + total,
+      count - (size_t) total, offset + total);
+    if (bytes > 0) {
+      total += bytes;
+    } else if (bytes == 0 || errno != EINTR) {
+      total = total > 0 ? total : bytes;
+      break;
+    } else {
+      errno = 0;
+    }
+  }
+  return RESULT_FROM_ERRNO(total, -1, RESULT(ssize_t, io_error));
+}
+
+/**
+ * Writes a buffer to a file descriptor.
+ *
+ * Calls interrupted by a signal are retried, and short writes are resumed.
+ * When a call fails after some bytes were written, those bytes are reported as
+ * a success, and `errno` is left holding the failure code; otherwise, `errno`
+ * is `0`.
+ *
+ * @param descriptor The file descriptor.
+ * @param buffer The buffer to write.
+ * @param count The number of bytes to write.
+ * @return A successful result holding the number of bytes written, or a
+ *   failed result holding the `errno` code.
+ */
+static inline RESULT(ssize_t, io_error) io_write(int descriptor,
+    const void * buffer, size_t count) {
+  ssize_t total = 0;
+  errno = 0;
+  while ((size_t) total < count) {
+    const ssize_t bytes = write(descriptor, (const char *) buffer + total,
+      count - (size_t) total);
+    if (bytes > 0) {
+      total += bytes;
+    } else if (bytes == 0 || errno != EINTR) {
+      total = total > 0 ? total : bytes;
+      break;
+    } else {
+      errno = 0;
+    }
+  }
+  return RESULT_FROM_ERRNO(total, -1, RESULT(ssize_t, io_error));
+}
+
+/**
+ * Maps a file into memory.
+ *
+ * @param address The preferred address of the mapping, or `NULL`.
+ * @param length The length of the mapping.
+ * @param protection The memory protection of the mapping.
+ * @param flags The mapping flags.
+ * @param descriptor The file descriptor.
+ * @param offset The file offset to map from.
+ * @return A successful result holding the address of the mapping, or a failed
+ *   result holding the `errno` code.
+ */
+static inline RESULT(io_pointer, io_error) io_mmap(void * address,
+    size_t length, int protection, int flags, int descriptor, off_t offset) {
+  io_pointer mapping = mmap(address, length, protection, flags, descriptor,
+    offset);
+  return RESULT_FROM_ERRNO(mapping, MAP_FAILED, RESULT(io_pointer, io_error));
+}
+
+/**
+ * Retrieves the status of a file.
+ *
+ * @param descriptor The file descriptor.
+ * @return A successful result holding the file status, or a failed result
+ *   holding the `errno` code.
+ */
+static inline RESULT(io_stat, io_error) io_fstat(int descriptor) {
+  io_stat status;
+  if (fstat(descriptor, &status) == -1) {
+    RESULT(io_stat, io_error) failure = RESULT_FAILURE(errno);
+    return failure;
+  }
+  RESULT(io_stat, io_error) success = RESULT_SUCCESS(status);
+  return success;
+}
+
+#endif
@@ -0,0 +1,447 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Memory-mapped failure log.
+ *
+ * This optional header records failures as fixed-size binary records in a
+ * file mapped into memory. The file holds a header followed by a ring of
+ * records; once the ring is full, the oldest records are overwritten.
+ *
+ * Appending a record reserves a slot with a relaxed atomic increment and
+ * fills in its 32 bytes, so any number of threads can log failures without
+ * locks or system calls. Each record carries a sequence number that is cleared
+ * while it is written, so that readers skip records that are being
+ * overwritten. The records reach the file when the kernel writes back the
+ * mapping, even if the process crashes.
+ *
+ * Logs are turned into text by #result_log_decode, or offline by the
+ * `result_log_decode` tool.
+ *
+ * ```c
+ * #include <result_log.h>
+ * ```
+ *
+ * @file        result_log.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_LOG_H
+#define RESULT_LOG_H
+
+#include <inttypes.h> /* PRIu64, PRId64 */
+#include <stdio.h> /* FILE, fprintf */
+#include <sys/file.h> /* flock, LOCK_EX */
+#include <sys/syscall.h> /* SYS_gettid */
+#include <time.h> /* clock_gettime, struct timespec */
+#include <result_io.h>
+
+#ifndef RESULT_LOG_CLOCK
+
+#ifdef CLOCK_REALTIME_COARSE
+
+/**
+ * Returns the clock that timestamps log records.
+ *
+ * The coarse clock is read from memory without a system call, at the cost of
+ * a resolution of a few milliseconds; records are still ordered by their
+ * sequence numbers. This value may be overridden by defining
+ * `RESULT_LOG_CLOCK` before including this header.
+ */
+#define RESULT_LOG_CLOCK CLOCK_REALTIME_COARSE
+
+#else
+
+/**
+ * Returns the clock that timestamps log records.
+ *
+ * This value may be overridden by defining `RESULT_LOG_CLOCK` before including
+ * this header.
+ */
+#define RESULT_LOG_CLOCK CLOCK_REALTIME
+
+#endif
+
+#endif
+
+/**
+ * The magic bytes that start a log file.
+ */
+#define RESULT_LOG_MAGIC "RESULTLG"
+
+/**
+ * Represents the header of a log file.
+ *
+ * @warning
+ * The members of this struct are implementation details. Logs SHOULD only be
+ * accessed via the functions provided in this header file.
+ */
+struct result_log_header {
+  char _magic[8];
+  uint32_t _version;
+  uint32_t _record_size;
+  uint64_t _capacity;
+  uint64_t _head;
+  uint8_t _reserved[32];
+};
+
+_Static_assert(sizeof(struct result_log_header) == 64,
+  "Log headers must fill a cache line");
+
+/**
+ * Represents a failure recorded in a log file.
+ *
+ * @warning
+ * The members of this struct are implementation details. Records SHOULD only
+ * be read via #result_log_decode.
+ */
+struct result_log_record {
+  uint64_t _timestamp;
+  int64_t _failure;
+  uint32_t _callsite;
+  uint32_t _thread;
+  uint64_t _sequence;
+};
+
+_Static_assert(sizeof(struct result_log_record) == 32,
+  "Log records must have a uniform stride");
+
+/**
+ * Represents a log file mapped into memory.
+ *
+ * @warning
+ * The members of this struct are implementation details. Logs SHOULD only be
+ * accessed via the functions provided in this header file.
+ *
+ * @see result_log_open
+ */
+struct result_log {
+  struct result_log_header * _header;
+  struct result_log_record * _records;
+  uint64_t _mask;
+  size_t _size;
+};
+
+RESULT_STRUCT(size_t, io_error);
+
+/**
+ * Checks whether some data holds a log file.
+ *
+ * @param header The header of the data.
+ * @param size The size in bytes of the data.
+ * @return `true` if the header is valid and the data can hold all the records
+ *   of the ring; `false` otherwise.
+ */
+static inline bool result_log_valid(const struct result_log_header * header,
+    size_t size) {
+  return size >= sizeof(struct result_log_header)
+    && memcmp(header->_magic, RESULT_LOG_MAGIC, sizeof(header->_magic)) == 0
+    && header->_record_size == sizeof(struct result_log_record)
+    && header->_capacity != 0
+    && (header->_capacity & (header->_capacity - 1)) == 0
+    && (size - sizeof(struct result_log_header))
+      / sizeof(struct result_log_record) >= header->_capacity;
+}
+
+/**
+ * Checks whether a file was created as a log but its header was never written.
+ *
+ * @warning
+ * This function is an implementation detail of #result_log_open and SHOULD NOT
+ * be called directly.
+ *
+ * @param header The header of the file, zero-filled past the end of the file.
+ * @param size The size in bytes of the file.
+ * @return `true` if the file is empty, or its header is zero and it is sized
+ *   like a log; `false` otherwise.
+ */
+static inline bool result_log_blank(const struct result_log_header * header,
+    size_t size) {
+  static const struct result_log_header zero = {._version = 0};
+  return size == 0 || (size >= sizeof(struct result_log_header)
+    && (size - sizeof(struct result_log_header))
+      % sizeof(struct result_log_record) == 0
+    && memcmp(header, &zero, sizeof(zero)) == 0);
+}
+
+/**
+ * Opens a log file, creating it if it does not exist.
+ *
+ * New files are sized to hold @p capacity records. Existing files keep their
+ * own capacity, and new records are appended after the ones they hold.
+ *
+ * The file is locked while it is opened, so that only one process initializes
+ * a new file. Files whose header is still zero, because the process that
+ * created them crashed before writing it, are initialized again.
+ *
+ * @b Example:
+ * @snippet example.c result_log
+ *
+ * @param log The log to initialize.
+ * @param path The path of the file.
+ * @param capacity The number of records of the ring; MUST be a power of two.
+ * @return A successful result, or a failed result holding the `errno` code,
+ *   or `EINVAL` if @p capacity is not a power of two or is too large, or the
+ *   file is not a log.
+ *
+ * @see result_log_close
+ */
+static inline RESULT_VOID(io_error) result_log_open(struct result_log * log,
+    const char * path, size_t capacity) {
+  *log = (struct result_log) {._header = NULL};
+  if (capacity == 0 || (capacity & (capacity - 1)) != 0
+      || capacity > (SIZE_MAX - sizeof(struct result_log_header))
+        / sizeof(struct result_log_record)) {
+    return (RESULT_VOID(io_error)) RESULT_FAILURE(EINVAL);
+  }
+  const RESULT(int, io_error) opened = io_open(path, O_RDWR | O_CREAT, 0644);
+  if (RESULT_HAS_FAILURE(opened)) {
+    return (RESULT_VOID(io_error)) RESULT_FAILURE(RESULT_USE_FAILURE(opened));
+  }
+  const int descriptor = RESULT_USE_SUCCESS(opened);
+  int locked;
+  do {
+    locked = flock(descriptor, LOCK_EX);
+  } while (locked == -1 && errno == EINTR);
+  const RESULT(io_stat, io_error) status = locked == -1
+    ? (RESULT(io_stat, io_error)) RESULT_FAILURE(errno)
+    : io_fstat(descriptor);
+  struct result_log_header existing = {._version = 0};
+  const RESULT(ssize_t, io_error) read = RESULT_HAS_FAILURE(status)
+    ? (RESULT(ssize_t, io_error)) RESULT_FAILURE(RESULT_USE_FAILURE(status))
+    : io_pread(descriptor, &existing, sizeof(existing), 0);
+  if (RESULT_HAS_FAILURE(read)) {
+    (void) close(descriptor);
+    return (RESULT_VOID(io_error)) RESULT_FAILURE(RESULT_USE_FAILURE(read));
+  }
+  size_t size = (size_t) RESULT_USE_SUCCESS(status).st_size;
+  const bool blank = result_log_blank(&existing, size);
+  if (blank) {
+    size = sizeof(struct result_log_header)
+      + capacity * sizeof(struct result_log_record);
+    if (ftruncate(descriptor, 0) == -1
+        || ftruncate(descriptor, (off_t) size) == -1) {
+      const int error = errno;
+      (void) close(descriptor);
+      return (RESULT_VOID(io_error)) RESULT_FAILURE(error);
+    }
+  }
+  const RESULT(io_pointer, io_error) mapping = io_mmap(NULL, size,
+    PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+  if (RESULT_HAS_FAILURE(mapping)) {
+    (void) close(descriptor);
+    return (RESULT_VOID(io_error)) RESULT_FAILURE(RESULT_USE_FAILURE(mapping));
+  }
+  struct result_log_header * header = RESULT_USE_SUCCESS(mapping);
+  if (blank) {
+    header->_version = 1;
+    header->_record_size = sizeof(struct result_log_record);
+    header->_capacity = capacity;
+    memcpy(header->_magic, RESULT_LOG_MAGIC, sizeof(header->_magic));
+  }
+  /* Closing the descriptor releases the lock */
+  (void) close(descriptor);
+  if (!result_log_valid(header, size)) {
+    (void) munmap(header, size);
+    return (RESULT_VOID(io_error)) RESULT_FAILURE(EINVAL);
+  }
+  log->_header = header;
+  log->_records = (struct result_log_record *) (header + 1);
+  log->_mask = header->_capacity - 1;
+  log->_size = size;
+  return (RESULT_VOID(io_error)) RESULT_VOID_SUCCESS();
+}
+
+/**
+ * Unmaps the file of a log.
+ *
+ * @param log The log to close.
+ *
+ * @see result_log_open
+ */
+static inline void result_log_close(struct result_log * log) {
+  if (log->_header != NULL) {
+    (void) munmap(log->_header, log->_size);
+  }
+  *log = (struct result_log) {._header = NULL};
+}
+
+/**
+ * Returns the identifier of the calling thread.
+ *
+ * The identifier is looked up once per thread, and cached afterwards.
+ *
+ * @return The thread identifier.
+ */
+static inline uint32_t result_log_thread(void) {
+  static _Thread_local uint32_t thread = 0;
+  if (thread == 0) {
+    thread = (uint32_t) syscall(SYS_gettid);
+  }
+  return thread;
+}
+
+/**
+ * Appends a failure to a log.
+ *
+ * A slot is reserved via a relaxed atomic increment. Its sequence number is
+ * cleared before the record is written, and set with release semantics after
+ * it, so that readers can tell when a record is being overwritten.
+ *
+ * @param log The log.
+ * @param callsite The identifier of the callsite of the failure.
+ * @param failure The failure code.
+ *
+ * @see RESULT_LOG_FAILURE
+ */
+static inline void result_log_append(struct result_log * log,
+    uint32_t callsite, int64_t failure) {
+  const uint64_t position = __atomic_fetch_add(&log->_header->_head, 1,
+    __ATOMIC_RELAXED);
+  struct result_log_record * record = &log->_records[position & log->_mask];
+  struct timespec now;
+  (void) clock_gettime(RESULT_LOG_CLOCK, &now);
+  __atomic_store_n(&record->_sequence, 0, __ATOMIC_RELAXED);
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  __atomic_store_n(&record->_timestamp, (uint64_t) now.tv_sec * 1000000000
+    + (uint64_t) now.tv_nsec, __ATOMIC_RELAXED);
+  __atomic_store_n(&record->_failure, failure, __ATOMIC_RELAXED);
+  __atomic_store_n(&record->_callsite, callsite, __ATOMIC_RELAXED);
+  __atomic_store_n(&record->_thread, result_log_thread(), __ATOMIC_RELAXED);
+  __atomic_store_n(&record->_sequence, position + 1, __ATOMIC_RELEASE);
+}
+
+#if !defined(NDEBUG) && defined(RESULT_DEBUG_CALLSITES)
+
+/**
+ * Returns the callsite identifier of a result.
+ *
+ * When `RESULT_DEBUG_CALLSITES` is defined, the identifier is the index of the
+ * callsite record of the result within the `__result_callsites` section, which
+ * can be resolved via #result_callsites_begin. Static results, and results
+ * without a callsite record, have the identifier `UINT32_MAX`.
+ *
+ * @param result The result.
+ * @return The callsite identifier of @p result.
+ */
+#define RESULT_LOG_CALLSITE(result)                                         \
+  (                                                                         \
+    result_callsite_is_record((result)._debug._site)                        \
+    ? (uint32_t) ((result)._debug._site - result_callsites_begin())         \
+    : UINT32_MAX                                                            \
+  )
+
+#else
+
+/**
+ * Returns the callsite identifier of a result.
+ *
+ * When `RESULT_DEBUG_CALLSITES` is not defined, results do not carry a
+ * callsite record, so the identifier is the line number where the failure is
+ * logged.
+ *
+ * @param result The result.
+ * @return The callsite identifier of @p result.
+ */
+#define RESULT_LOG_CALLSITE(result)                                         \
+  ((uint32_t) __LINE__)
+
+#endif
+
+/**
+ * Appends the failure value of a result to a log, if the result is failed.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ * @pre The failure type of @b result MUST be an integer or enumeration type.
+ *
+ * @b Example:
+ * @snippet example.c result_log
+ *
+ * @param log The log.
+ * @param result The result whose failure will be logged.
+ *
+ * @see result_log_append
+ */
+#define RESULT_LOG_FAILURE(log, result)                                     \
+  (                                                                         \
+    (void) &(result),                                                       \
+    RESULT_HAS_FAILURE(result)                                              \
+    ? result_log_append((log), RESULT_LOG_CALLSITE(result),                 \
+      (int64_t) RESULT_USE_FAILURE(result))                                 \
+    : (void) 0                                                              \
+  )
+
+/**
+ * Writes the records of a log file as text, oldest first.
+ *
+ * Each record is written on its own line as its sequence number, timestamp in
+ * seconds, thread identifier, callsite identifier and failure code. Slots that
+ * were never written, or that were being overwritten while they were read, are
+ * skipped.
+ *
+ * @param stream The stream to write to.
+ * @param data The contents of the log file.
+ * @param size The size in bytes of @p data.
+ * @return A successful result holding the number of records written, or a
+ *   failed result holding `EINVAL` if @p data is not a log file.
+ */
+static inline RESULT(size_t, io_error) result_log_decode(FILE * stream,
+    const void * data, size_t size) {
+  const struct result_log_header * header = data;
+  if (!result_log_valid(header, size)) {
+    return (RESULT(size_t, io_error)) RESULT_FAILURE(EINVAL);
+  }
+  const struct result_log_record * records =
+    (const struct result_log_record *) (header + 1);
+  const uint64_t head = __atomic_load_n(&header->_head, __ATOMIC_ACQUIRE);
+  const uint64_t first = head > header->_capacity
+    ? head - header->_capacity : 0;
+  size_t count = 0;
+  for (uint64_t position = first; position < head; position++) {
+    const struct result_log_record * slot =
+      &records[position & (header->_capacity - 1)];
+    if (__atomic_load_n(&slot->_sequence, __ATOMIC_ACQUIRE) != position + 1) {
+      continue;
+    }
+    const struct result_log_record record = {
+      ._timestamp = __atomic_load_n(&slot->_timestamp, __ATOMIC_RELAXED),
+      ._failure = __atomic_load_n(&slot->_failure, __ATOMIC_RELAXED),
+      ._callsite = __atomic_load_n(&slot->_callsite, __ATOMIC_RELAXED),
+      ._thread = __atomic_load_n(&slot->_thread, __ATOMIC_RELAXED),
+      ._sequence = position + 1
+    };
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (__atomic_load_n(&slot->_sequence, __ATOMIC_RELAXED) != position + 1) {
+      continue;
+    }
+    (void) fprintf(stream, "#%" PRIu64 " %" PRIu64 ".%09" PRIu64
+      " thread=%" PRIu32 " callsite=%" PRIu32 " failure=%" PRId64 "\n",
+      record._sequence, record._timestamp / 1000000000,
+      record._timestamp % 1000000000, record._thread, record._callsite,
+      record._failure);
+    count++;
+  }
+  return (RESULT(size_t, io_error)) RESULT_SUCCESS(count);
+}
+
+#endif
@@ -0,0 +1,522 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Lazily formatted failure messages.
+ *
+ * This optional header adds failures that hold a format string and its
+ * arguments, so that creating a failed result does not pay for formatting a
+ * message that may never be read. The message is formatted into a buffer
+ * supplied by the caller when it is read via #RESULT_FAILURE_MESSAGE.
+ *
+ * ```c
+ * #include <result_message.h>
+ * ```
+ *
+ * @file        result_message.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_MESSAGE_H
+#define RESULT_MESSAGE_H
+
+#include <result.h>
+#include <stdio.h> /* snprintf */
+#include <string.h> /* memcpy, strchr, strlen, strspn */
+
+#ifndef RESULT_MESSAGE_ARGS
+
+/**
+ * Returns the maximum number of arguments of a lazily formatted message.
+ *
+ * This value may be lowered, down to one, by defining `RESULT_MESSAGE_ARGS`
+ * before including this header, so that messages take less space. It MUST be
+ * the same in every source file. Messages with more arguments are rejected at
+ * compile time.
+ *
+ * @see RESULT_FAILURE_FMT
+ */
+#define RESULT_MESSAGE_ARGS 4
+
+#endif
+
+/**
+ * The type of an argument of a lazily formatted message.
+ *
+ * @warning
+ * This type is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+enum result_message_type {
+  RESULT_MESSAGE_INT,
+  RESULT_MESSAGE_UINT,
+  RESULT_MESSAGE_DOUBLE,
+  RESULT_MESSAGE_STRING,
+  RESULT_MESSAGE_POINTER
+};
+
+/**
+ * An argument of a lazily formatted message.
+ *
+ * @warning
+ * This type is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+struct result_message_arg {
+  enum result_message_type _type;
+  union {
+    long long _int;
+    unsigned long long _uint;
+    double _double;
+    const char * _string;
+    const void * _pointer;
+  } _value;
+};
+
+/**
+ * A lazily formatted message.
+ *
+ * Messages hold a format string and up to #RESULT_MESSAGE_ARGS arguments, and
+ * are formatted only when read via #RESULT_FAILURE_MESSAGE.
+ *
+ * @see RESULT_FAILURE_FMT
+ */
+struct result_message {
+  const char * _format;
+  size_t _count;
+  struct result_message_arg _args[RESULT_MESSAGE_ARGS];
+};
+
+/**
+ * Initializes a new failed result holding a lazily formatted message.
+ *
+ * Unlike formatting the message via `snprintf`, only the format string and
+ * the arguments are stored: formatting happens when the message is read via
+ * #RESULT_FAILURE_MESSAGE.
+ *
+ * @pre The failure type of the result MUST be `struct result_message`.
+ * @pre There MUST NOT be more than #RESULT_MESSAGE_ARGS arguments. This is
+ *   checked at compile time.
+ * @pre Each argument MUST be an integer, a floating-point number, a string, or
+ *   a `void` pointer.
+ * @pre String arguments MUST outlive the result.
+ *
+ * @note
+ * Conversion specifiers are matched against the actual types of the arguments,
+ * so length modifiers are not required. Field widths and precisions given as
+ * `*` are not supported.
+ *
+ * @b Example:
+ * @snippet example.c result_failure_fmt
+ *
+ * @param ... The format string, followed by the arguments.
+ * @return A new failed result holding the lazily formatted message.
+ *
+ * @see RESULT_FAILURE_MESSAGE
+ */
+#define RESULT_FAILURE_FMT(...)                                             \
+  RESULT_FAILURE(RESULT_MESSAGE(__VA_ARGS__))
+
+/**
+ * Formats the message of a failed result holding a lazily formatted message.
+ *
+ * @pre @b result MUST be an @e lvalue.
+ * @pre @b result MUST be failed.
+ *
+ * @b Example:
+ * @snippet example.c result_failure_fmt
+ *
+ * @param result The result holding the lazily formatted message.
+ * @param buffer The buffer to format the message into.
+ * @param length The buffer length.
+ * @return @b buffer, holding the formatted message, truncated if necessary.
+ *
+ * @see RESULT_FAILURE_FMT
+ */
+#define RESULT_FAILURE_MESSAGE(result, buffer, length)                      \
+  result_message_format(&RESULT_USE_FAILURE(result), (buffer), (length))
+
+/**
+ * Creates a lazily formatted message.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+#define RESULT_MESSAGE(...)                                                 \
+  RESULT_MESSAGE_SELECT(                                                    \
+    __VA_ARGS__,                                                            \
+    RESULT_MESSAGE_4,                                                       \
+    RESULT_MESSAGE_3,                                                       \
+    RESULT_MESSAGE_2,                                                       \
+    RESULT_MESSAGE_1,                                                       \
+    RESULT_MESSAGE_0,                                                       \
+    RESULT_MESSAGE_TOO_MANY_ARGUMENTS                                       \
+  )(__VA_ARGS__)
+
+/**
+ * Selects the macro that creates a message with the right number of arguments.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+#define RESULT_MESSAGE_SELECT(f, a1, a2, a3, a4, macro, ...) macro
+
+/**
+ * Checks that a lazily formatted message does not have too many arguments.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ *
+ * @param count The number of arguments.
+ */
+#define RESULT_MESSAGE_CHECK(count)                                         \
+  (void) sizeof(struct {                                                    \
+    _Static_assert(                                                         \
+      (count) <= RESULT_MESSAGE_ARGS,                                       \
+      "Lazily formatted messages cannot exceed RESULT_MESSAGE_ARGS"         \
+    );                                                                      \
+    char _unused;                                                           \
+  })
+
+/**
+ * Creates a lazily formatted message with no arguments.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+#define RESULT_MESSAGE_0(format)                                            \
+  ((struct result_message) { ._format = (format), ._count = 0 })
+
+/**
+ * Creates a lazily formatted message with one argument.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+#define RESULT_MESSAGE_1(format, a1)                                        \
+  (                                                                         \
+    RESULT_MESSAGE_CHECK(1),                                                \
+    ((struct result_message) {                                              \
+      ._format = (format),                                                  \
+      ._count = 1,                                                          \
+      ._args = { RESULT_MESSAGE_ARG(a1) }                                   \
+    })                                                                      \
+  )
+
+/**
+ * Creates a lazily formatted message with two arguments.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+#define RESULT_MESSAGE_2(format, a1, a2)                                    \
+  (                                                                         \
+    RESULT_MESSAGE_CHECK(2),                                                \
+    ((struct result_message) {                                              \
+      ._format = (format),                                                  \
+      ._count = 2,                                                          \
+      ._args = { RESULT_MESSAGE_ARG(a1), RESULT_MESSAGE_ARG(a2) }           \
+    })                                                                      \
+  )
+
+/**
+ * Creates a lazily formatted message with three arguments.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+#define RESULT_MESSAGE_3(format, a1, a2, a3)                                \
+  (                                                                         \
+    RESULT_MESSAGE_CHECK(3),                                                \
+    ((struct result_message) {                                              \
+      ._format = (format),                                                  \
+      ._count = 3,                                                          \
+      ._args = {                                                            \
+        RESULT_MESSAGE_ARG(a1),                                             \
+        RESULT_MESSAGE_ARG(a2),                                             \
+        RESULT_MESSAGE_ARG(a3)                                              \
+      }                                                                     \
+    })                                                                      \
+  )
+
+/**
+ * Creates a lazily formatted message with four arguments.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+#define RESULT_MESSAGE_4(format, a1, a2, a3, a4)                            \
+  (                                                                         \
+    RESULT_MESSAGE_CHECK(4),                                                \
+    ((struct result_message) {                                              \
+      ._format = (format),                                                  \
+      ._count = 4,                                                          \
+      ._args = {                                                            \
+        RESULT_MESSAGE_ARG(a1),                                             \
+        RESULT_MESSAGE_ARG(a2),                                             \
+        RESULT_MESSAGE_ARG(a3),                                             \
+        RESULT_MESSAGE_ARG(a4)                                              \
+      }                                                                     \
+    })                                                                      \
+  )
+
+/**
+ * Stores an argument of a lazily formatted message along with its type.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_FAILURE_FMT and SHOULD NOT
+ * be used directly.
+ */
+#define RESULT_MESSAGE_ARG(arg)                                             \
+  _Generic((arg),                                                           \
+    _Bool: result_message_uint,                                             \
+    char: result_message_int,                                               \
+    signed char: result_message_int,                                        \
+    short: result_message_int,                                              \
+    int: result_message_int,                                                \
+    long: result_message_int,                                               \
+    long long: result_message_int,                                          \
+    unsigned char: result_message_uint,                                     \
+    unsigned short: result_message_uint,                                    \
+    unsigned int: result_message_uint,                                      \
+    unsigned long: result_message_uint,                                     \
+    unsigned long long: result_message_uint,                                \
+    float: result_message_double,                                           \
+    double: result_message_double,                                          \
+    char *: result_message_string,                                          \
+    const char *: result_message_string,                                    \
+    void *: result_message_pointer,                                         \
+    const void *: result_message_pointer                                    \
+  )(arg)
+
+/**
+ * Stores a signed integer argument of a lazily formatted message.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_FAILURE_FMT and SHOULD
+ * NOT be called directly.
+ *
+ * @param value The argument.
+ * @return The stored argument.
+ */
+static inline struct result_message_arg result_message_int(long long value) {
+  return (struct result_message_arg) {
+    ._type = RESULT_MESSAGE_INT,
+    ._value = { ._int = value }
+  };
+}
+
+/**
+ * Stores an unsigned integer argument of a lazily formatted message.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_FAILURE_FMT and SHOULD
+ * NOT be called directly.
+ *
+ * @param value The argument.
+ * @return The stored argument.
+ */
+static inline struct result_message_arg result_message_uint(
+    unsigned long long value) {
+  return (struct result_message_arg) {
+    ._type = RESULT_MESSAGE_UINT,
+    ._value = { ._uint = value }
+  };
+}
+
+/**
+ * Stores a floating-point argument of a lazily formatted message.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_FAILURE_FMT and SHOULD
+ * NOT be called directly.
+ *
+ * @param value The argument.
+ * @return The stored argument.
+ */
+static inline struct result_message_arg result_message_double(double value) {
+  return (struct result_message_arg) {
+    ._type = RESULT_MESSAGE_DOUBLE,
+    ._value = { ._double = value }
+  };
+}
+
+/**
+ * Stores a string argument of a lazily formatted message.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_FAILURE_FMT and SHOULD
+ * NOT be called directly.
+ *
+ * @param value The argument.
+ * @return The stored argument.
+ */
+static inline struct result_message_arg result_message_string(
+    const char * value) {
+  return (struct result_message_arg) {
+    ._type = RESULT_MESSAGE_STRING,
+    ._value = { ._string = value }
+  };
+}
+
+/**
+ * Stores a pointer argument of a lazily formatted message.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_FAILURE_FMT and SHOULD
+ * NOT be called directly.
+ *
+ * @param value The argument.
+ * @return The stored argument.
+ */
+static inline struct result_message_arg result_message_pointer(
+    const void * value) {
+  return (struct result_message_arg) {
+    ._type = RESULT_MESSAGE_POINTER,
+    ._value = { ._pointer = value }
+  };
+}
+
+/**
+ * Formats a single conversion specification of a lazily formatted message.
+ *
+ * The length modifiers of the conversion specification are replaced with the
+ * ones matching the type of the stored argument.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_FAILURE_MESSAGE and
+ * SHOULD NOT be called directly.
+ *
+ * @param buffer The buffer to format the argument into.
+ * @param length The buffer length.
+ * @param flags The flags, field width and precision of the specification.
+ * @param flags_length The length of @b flags.
+ * @param conversion The conversion specifier.
+ * @param arg The argument.
+ * @return The number of characters that would have been written.
+ */
+static inline int result_message_format_arg(char * buffer, size_t length,
+    const char * flags, size_t flags_length, char conversion,
+    const struct result_message_arg * arg) {
+  char specification[32];
+  const char * modifier = "";
+  switch (arg->_type) {
+    case RESULT_MESSAGE_INT:
+      modifier = conversion == 'c' ? "" : "ll";
+      conversion = strchr("cdi", conversion) ? conversion : 'd';
+      break;
+    case RESULT_MESSAGE_UINT:
+      modifier = conversion == 'c' ? "" : "ll";
+      conversion = strchr("couxX", conversion) ? conversion : 'u';
+      break;
+    case RESULT_MESSAGE_DOUBLE:
+      conversion = strchr("aAeEfFgG", conversion) ? conversion : 'g';
+      break;
+    case RESULT_MESSAGE_STRING:
+      conversion = 's';
+      break;
+    case RESULT_MESSAGE_POINTER:
+      conversion = 'p';
+      break;
+  }
+  const size_t modifier_length = strlen(modifier);
+  if (flags_length > sizeof(specification) - modifier_length - 3) {
+    flags_length = sizeof(specification) - modifier_length - 3;
+  }
+  specification[0] = '%';
+  memcpy(specification + 1, flags, flags_length);
+  memcpy(specification + 1 + flags_length, modifier, modifier_length);
+  specification[1 + flags_length + modifier_length] = conversion;
+  specification[2 + flags_length + modifier_length] = '\0';
+  switch (arg->_type) {
+    case RESULT_MESSAGE_INT:
+      return conversion == 'c'
+        ? snprintf(buffer, length, specification, (int) arg->_value._int)
+        : snprintf(buffer, length, specification, arg->_value._int);
+    case RESULT_MESSAGE_UINT:
+      return conversion == 'c'
+        ? snprintf(buffer, length, specification, (int) arg->_value._uint)
+        : snprintf(buffer, length, specification, arg->_value._uint);
+    case RESULT_MESSAGE_DOUBLE:
+      return snprintf(buffer, length, specification, arg->_value._double);
+    case RESULT_MESSAGE_STRING:
+      return snprintf(buffer, length, specification, arg->_value._string);
+    default:
+      return snprintf(buffer, length, specification, arg->_value._pointer);
+  }
+}
+
+/**
+ * Formats a lazily formatted message.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_FAILURE_MESSAGE and
+ * SHOULD NOT be called directly.
+ *
+ * @param message The lazily formatted message.
+ * @param buffer The buffer to format the message into.
+ * @param length The buffer length.
+ * @return @b buffer, holding the formatted message, truncated if necessary.
+ */
+static inline char * result_message_format(
+    const struct result_message * message, char * buffer, size_t length) {
+  const char * cursor = message->_format;
+  size_t used = 0;
+  size_t next = 0;
+  if (length == 0) {
+    return buffer;
+  }
+  buffer[0] = '\0';
+  while (*cursor != '\0' && used + 1 < length) {
+    if (cursor[0] != '%' || cursor[1] == '%') {
+      buffer[used++] = *cursor;
+      cursor += cursor[0] == '%' ? 2 : 1;
+      continue;
+    }
+    const char * flags = ++cursor;
+    cursor += strspn(cursor, "-+ #0123456789.");
+    const size_t flags_length = (size_t) (cursor - flags);
+    cursor += strspn(cursor, "hljztL");
+    if (*cursor == '\0' || next >= message->_count) {
+      break;
+    }
+    const int written = result_message_format_arg(buffer + used,
+      length - used, flags, flags_length, *cursor++, &message->_args[next++]);
+    if (written > 0) {
+      used += (size_t) written < length - used
+        ? (size_t) written : length - used - 1;
+    }
+  }
+  buffer[used] = '\0';
+  return buffer;
+}
+
+#endif
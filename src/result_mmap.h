@@ -0,0 +1,245 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Memory-mapped file reading with zero-copy slices.
+ *
+ * This optional header maps a whole file into memory and hands out slices that
+ * point into the mapping, as results. Slices are never copied into a buffer,
+ * and every slice is checked against the bounds of the mapping.
+ *
+ * ```c
+ * #include <result_mmap.h>
+ * ```
+ *
+ * @file        result_mmap.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_MMAP_H
+#define RESULT_MMAP_H
+
+#include <result_io.h>
+
+#ifndef RESULT_SLICE_TYPE
+#define RESULT_SLICE_TYPE
+
+/**
+ * Represents a read-only sequence of bytes that is not owned.
+ *
+ * @note
+ * This type is shared with `result_strview.h`, where it is also known as
+ * #strview, so that slices can be parsed without conversion.
+ *
+ * @see SLICE_DATA
+ * @see SLICE_LENGTH
+ */
+typedef struct slice {
+  const char * _data;
+  size_t _length;
+} slice;
+
+#endif
+
+RESULT_STRUCT(slice, io_error);
+
+/**
+ * Returns a pointer to the first byte of a slice.
+ *
+ * @param slice The slice.
+ * @return The pointer to the bytes of @p slice.
+ */
+#define SLICE_DATA(slice)                                                   \
+  ((slice)._data)
+
+/**
+ * Returns the number of bytes of a slice.
+ *
+ * @param slice The slice.
+ * @return The length of @p slice.
+ */
+#define SLICE_LENGTH(slice)                                                 \
+  ((slice)._length)
+
+/**
+ * Represents a file mapped into memory, and a reading position within it.
+ *
+ * @warning
+ * The members of this struct are implementation details. Readers SHOULD only
+ * be accessed via the functions provided in this header file.
+ *
+ * @see mmap_reader_open
+ */
+struct mmap_reader {
+  const char * _data;
+  size_t _size;
+  size_t _position;
+};
+
+/**
+ * Maps a file into memory for reading.
+ *
+ * The file is mapped read-only, and the kernel is advised that it will be read
+ * sequentially, so that it can read ahead aggressively and drop pages early.
+ * The file descriptor is closed before returning, since the mapping keeps the
+ * file open.
+ *
+ * @b Example:
+ * @snippet example.c mmap_reader
+ *
+ * @param reader The reader to initialize.
+ * @param path The path of the file.
+ * @return A successful result, or a failed result holding the `errno` code.
+ *
+ * @see mmap_reader_close
+ */
+static inline RESULT_VOID(io_error) mmap_reader_open(
+    struct mmap_reader * reader, const char * path) {
+  *reader = (struct mmap_reader) {._data = NULL};
+  const RESULT(int, io_error) opened = io_open(path, O_RDONLY, 0);
+  if (RESULT_HAS_FAILURE(opened)) {
+    return (RESULT_VOID(io_error)) RESULT_FAILURE(RESULT_USE_FAILURE(opened));
+  }
+  const int descriptor = RESULT_USE_SUCCESS(opened);
+  const RESULT(io_stat, io_error) status = io_fstat(descriptor);
+  if (RESULT_HAS_FAILURE(status)) {
+    (void) close(descriptor);
+    return (RESULT_VOID(io_error)) RESULT_FAILURE(RESULT_USE_FAILURE(status));
+  }
+  const size_t size = (size_t) RESULT_USE_SUCCESS(status).st_size;
+  if (size > 0) {
+    const RESULT(io_pointer, io_error) mapping = io_mmap(NULL, size,
+      PROT_READ, MAP_PRIVATE, descriptor, 0);
+    if (RESULT_HAS_FAILURE(mapping)) {
+      (void) close(descriptor);
+      return (RESULT_VOID(io_error))
+        RESULT_FAILURE(RESULT_USE_FAILURE(mapping));
+    }
+    (void) madvise(RESULT_USE_SUCCESS(mapping), size, MADV_SEQUENTIAL);
+    reader->_data = RESULT_USE_SUCCESS(mapping);
+    reader->_size = size;
+  }
+  (void) close(descriptor);
+  return (RESULT_VOID(io_error)) RESULT_VOID_SUCCESS();
+}
+
+/**
+ * Unmaps the file of a reader.
+ *
+ * @warning
+ * Slices obtained from @p reader MUST NOT be used afterwards.
+ *
+ * @param reader The reader to close.
+ *
+ * @see mmap_reader_open
+ */
+static inline void mmap_reader_close(struct mmap_reader * reader) {
+  if (reader->_data != NULL) {
+    (void) munmap((void *) reader->_data, reader->_size);
+  }
+  *reader = (struct mmap_reader) {._data = NULL};
+}
+
+/**
+ * Returns the size in bytes of the file of a reader.
+ *
+ * @param reader The reader.
+ * @return The size of the mapped file.
+ */
+static inline size_t mmap_reader_size(const struct mmap_reader * reader) {
+  return reader->_size;
+}
+
+/**
+ * Returns a slice of the file of a reader.
+ *
+ * @param reader The reader.
+ * @param offset The offset of the first byte of the slice.
+ * @param length The length of the slice.
+ * @return A successful result holding the slice, or a failed result holding
+ *   `ERANGE` if the slice exceeds the bounds of the file.
+ */
+static inline RESULT(slice, io_error) mmap_reader_slice(
+    const struct mmap_reader * reader, size_t offset, size_t length) {
+  if (offset > reader->_size || length > reader->_size - offset) {
+    return (RESULT(slice, io_error)) RESULT_FAILURE(ERANGE);
+  }
+  return (RESULT(slice, io_error)) RESULT_SUCCESS(
+    ((slice) {._data = reader->_data + offset, ._length = length}));
+}
+
+/**
+ * Reads the next line of the file of a reader.
+ *
+ * Lines are terminated by `\n`, which is not included in the slice. The last
+ * line of the file does not need to be terminated.
+ *
+ * @param reader The reader.
+ * @return A successful result holding the line, or a failed result holding
+ *   `ENODATA` if the end of the file was reached.
+ *
+ * @see mmap_reader_next_record
+ */
+static inline RESULT(slice, io_error) mmap_reader_next_line(
+    struct mmap_reader * reader) {
+  const size_t position = reader->_position;
+  if (position >= reader->_size) {
+    return (RESULT(slice, io_error)) RESULT_FAILURE(ENODATA);
+  }
+  const size_t remaining = reader->_size - position;
+  const char * start = reader->_data + position;
+  const char * end = memchr(start, '\n', remaining);
+  const size_t length = end == NULL ? remaining : (size_t) (end - start);
+  reader->_position = position + length + (end == NULL ? 0 : 1);
+  return (RESULT(slice, io_error)) RESULT_SUCCESS(
+    ((slice) {._data = start, ._length = length}));
+}
+
+/**
+ * Reads the next fixed-size record of the file of a reader.
+ *
+ * @param reader The reader.
+ * @param size The size in bytes of each record.
+ * @return A successful result holding the record, or a failed result holding
+ *   `ENODATA` if the end of the file was reached, `ERANGE` if the file ends
+ *   with an incomplete record, or `EINVAL` if @p size is zero.
+ *
+ * @see mmap_reader_next_line
+ */
+static inline RESULT(slice, io_error) mmap_reader_next_record(
+    struct mmap_reader * reader, size_t size) {
+  if (size == 0) {
+    return (RESULT(slice, io_error)) RESULT_FAILURE(EINVAL);
+  }
+  if (reader->_position >= reader->_size) {
+    return (RESULT(slice, io_error)) RESULT_FAILURE(ENODATA);
+  }
+  const RESULT(slice, io_error) record = mmap_reader_slice(reader,
+    reader->_position, size);
+  if (RESULT_HAS_SUCCESS(record)) {
+    reader->_position += size;
+  }
+  return record;
+}
+
+#endif
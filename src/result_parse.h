@@ -0,0 +1,399 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Result-returning number parsing.
+ *
+ * This optional header parses decimal numbers into results, as a replacement
+ * for `sscanf` and the `strto*` family of functions. Parsing is strict: the
+ * whole string must be a number, with no surrounding whitespace, and the
+ * reason why a string is not a number is reported as a #parse_error.
+ *
+ * ```c
+ * #include <result_parse.h>
+ * ```
+ *
+ * Digits are converted eight at a time, using plain 64-bit arithmetic.
+ *
+ * @file        result_parse.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_PARSE_H
+#define RESULT_PARSE_H
+
+#include <errno.h> /* errno, ERANGE */
+#include <limits.h> /* INT_MAX */
+#include <locale.h> /* localeconv */
+#include <math.h> /* HUGE_VAL */
+#include <stdlib.h> /* strtod */
+#include <result.h>
+
+/**
+ * Represents the reason why a string could not be parsed.
+ */
+typedef enum parse_error {
+  /** The string is empty. */
+  PARSE_ERROR_EMPTY = 1,
+  /** The string does not start with a number. */
+  PARSE_ERROR_INVALID,
+  /** The number does not fit in the target type. */
+  PARSE_ERROR_OVERFLOW,
+  /** The number is followed by other characters. */
+  PARSE_ERROR_TRAILING
+} parse_error;
+
+#ifndef RESULT_PARSE_MAX_LENGTH
+
+/**
+ * Returns the maximum length of numbers that need to be copied before being
+ * converted via `strtod`.
+ *
+ * Numbers that are not followed by a null character, or whose decimal point
+ * differs from that of the current locale, are copied into a stack buffer of
+ * this size before conversion; longer ones are reported as
+ * #PARSE_ERROR_OVERFLOW. This value may be overridden by defining
+ * `RESULT_PARSE_MAX_LENGTH` before including this header.
+ */
+#define RESULT_PARSE_MAX_LENGTH 128
+
+#endif
+
+RESULT_STRUCT(int, parse_error);
+
+RESULT_STRUCT(int64_t, parse_error);
+
+RESULT_STRUCT(double, parse_error);
+
+/**
+ * Returns a textual representation of the supplied parse error.
+ *
+ * @param error The parse error.
+ * @return The error message.
+ */
+static inline const char * parse_error_message(parse_error error) {
+  switch (error) {
+    case PARSE_ERROR_EMPTY: return "Empty string";
+    case PARSE_ERROR_INVALID: return "Not a number";
+    case PARSE_ERROR_OVERFLOW: return "Number out of range";
+    case PARSE_ERROR_TRAILING: return "Trailing characters";
+    default: return "Unknown parse error";
+  }
+}
+
+/**
+ * Checks whether eight bytes are all decimal digits.
+ *
+ * @warning
+ * This function is an implementation detail and SHOULD NOT be called directly.
+ *
+ * @param chunk The bytes, in memory order.
+ * @return `true` if every byte is a decimal digit; `false` otherwise.
+ */
+static inline bool parse_eight_digits_valid(uint64_t chunk) {
+  return (((chunk + 0x4646464646464646) | (chunk - 0x3030303030303030))
+    & 0x8080808080808080) == 0;
+}
+
+/**
+ * Converts eight decimal digits to their value.
+ *
+ * @warning
+ * This function is an implementation detail and SHOULD NOT be called directly.
+ *
+ * @param chunk The digits, in memory order, with the first digit in the least
+ *   significant byte.
+ * @return The value of the digits.
+ */
+static inline uint64_t parse_eight_digits(uint64_t chunk) {
+  const uint64_t mask = 0x000000FF000000FF;
+  const uint64_t mul1 = 0x000F424000000064; /* 100 + (1000000 << 32) */
+  const uint64_t mul2 = 0x0000271000000001; /* 1 + (10000 << 32) */
+  chunk -= 0x3030303030303030;
+  chunk = (chunk * 10) + (chunk >> 8);
+  return (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+}
+
+/**
+ * Accumulates a run of decimal digits.
+ *
+ * @warning
+ * This function is an implementation detail and SHOULD NOT be called directly.
+ *
+ * @param text The text to parse.
+ * @param length The length of the text.
+ * @param value The accumulated value.
+ * @param overflow Set to `true` if the accumulated value overflows.
+ * @return The number of digits consumed.
+ */
+static inline size_t parse_digits(const char * text, size_t length,
+    uint64_t * value, bool * overflow) {
+  size_t index = 0;
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  while (length - index >= 8) {
+    uint64_t chunk;
+    memcpy(&chunk, text + index, sizeof(chunk));
+    if (!parse_eight_digits_valid(chunk)) {
+      break;
+    }
+    const uint64_t digits = parse_eight_digits(chunk);
+    if (*value > (UINT64_MAX - digits) / 100000000) {
+      *overflow = true;
+    } else {
+      *value = *value * 100000000 + digits;
+    }
+    index += 8;
+  }
+#endif
+  while (index < length && text[index] >= '0' && text[index] <= '9') {
+    const uint64_t digit = (uint64_t) (text[index] - '0');
+    if (*value > (UINT64_MAX - digit) / 10) {
+      *overflow = true;
+    } else {
+      *value = *value * 10 + digit;
+    }
+    index++;
+  }
+  return index;
+}
+
+/**
+ * Parses a signed decimal integer whose magnitude does not exceed a limit.
+ *
+ * @warning
+ * This function is an implementation detail and SHOULD NOT be called directly.
+ *
+ * @param text The text to parse.
+ * @param length The length of the text.
+ * @param limit The maximum positive value.
+ * @param magnitude The absolute value of the parsed number.
+ * @param negative Set to `true` if the parsed number is negative.
+ * @return `0` if the text was parsed; a parse error otherwise.
+ */
+static inline int parse_integer(const char * text, size_t length,
+    uint64_t limit, uint64_t * magnitude, bool * negative) {
+  size_t index = 0;
+  bool overflow = false;
+  if (length == 0) {
+    return PARSE_ERROR_EMPTY;
+  }
+  *negative = text[0] == '-';
+  if (text[0] == '-' || text[0] == '+') {
+    index++;
+  }
+  const size_t digits = parse_digits(text + index, length - index, magnitude,
+    &overflow);
+  if (digits == 0) {
+    return PARSE_ERROR_INVALID;
+  }
+  if (index + digits != length) {
+    return PARSE_ERROR_TRAILING;
+  }
+  if (overflow || *magnitude > limit + (*negative ? 1 : 0)) {
+    return PARSE_ERROR_OVERFLOW;
+  }
+  return 0;
+}
+
+/**
+ * Parses an `int` from the supplied string.
+ *
+ * The string must consist of an optional `+` or `-` sign followed by one or
+ * more decimal digits.
+ *
+ * @b Example:
+ * @snippet example.c parse_int
+ *
+ * @param text The string to parse.
+ * @return A successful result holding the parsed number, or a failed result
+ *   holding a #parse_error.
+ *
+ * @see parse_int64
+ */
+static inline RESULT(int, parse_error) parse_int(const char * text) {
+  uint64_t magnitude = 0;
+  bool negative = false;
+  const int error = parse_integer(text, strlen(text), INT_MAX, &magnitude,
+    &negative);
+  if (error != 0) {
+    RESULT(int, parse_error) failure = RESULT_FAILURE((parse_error) error);
+    return failure;
+  }
+  RESULT(int, parse_error) success = RESULT_SUCCESS(negative
+    ? (int) (-(int64_t) magnitude) : (int) magnitude);
+  return success;
+}
+
+/**
+ * Parses an `int64_t` from the supplied string.
+ *
+ * The string must consist of an optional `+` or `-` sign followed by one or
+ * more decimal digits.
+ *
+ * @param text The string to parse.
+ * @return A successful result holding the parsed number, or a failed result
+ *   holding a #parse_error.
+ *
+ * @see parse_int
+ */
+static inline RESULT(int64_t, parse_error) parse_int64(const char * text) {
+  uint64_t magnitude = 0;
+  bool negative = false;
+  const int error = parse_integer(text, strlen(text), INT64_MAX,
+    &magnitude, &negative);
+  if (error != 0) {
+    RESULT(int64_t, parse_error) failure = RESULT_FAILURE((parse_error) error);
+    return failure;
+  }
+  RESULT(int64_t, parse_error) success = RESULT_SUCCESS(negative
+    ? (int64_t) (0 - magnitude) : (int64_t) magnitude);
+  return success;
+}
+
+/**
+ * Parses a decimal real number.
+ *
+ * @warning
+ * This function is an implementation detail and SHOULD NOT be called directly.
+ *
+ * @param text The text to parse.
+ * @param length The length of the text.
+ * @param terminated Whether the text is followed by a null character.
+ * @param value The parsed number.
+ * @return `0` if the text was parsed; a parse error otherwise.
+ */
+static inline int parse_real(const char * text, size_t length,
+    bool terminated, double * value) {
+  static const double powers[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+  };
+  size_t index = 0;
+  uint64_t mantissa = 0;
+  uint64_t exponent = 0;
+  bool overflow = false;
+  bool negative_exponent = false;
+  if (length == 0) {
+    return PARSE_ERROR_EMPTY;
+  }
+  const bool negative = text[0] == '-';
+  if (text[0] == '-' || text[0] == '+') {
+    index++;
+  }
+  const size_t integer_digits = parse_digits(text + index, length - index,
+    &mantissa, &overflow);
+  index += integer_digits;
+  size_t fraction_digits = 0;
+  if (index < length && text[index] == '.') {
+    index++;
+    fraction_digits = parse_digits(text + index, length - index, &mantissa,
+      &overflow);
+    index += fraction_digits;
+  }
+  if (integer_digits + fraction_digits == 0) {
+    return PARSE_ERROR_INVALID;
+  }
+  if (index < length && (text[index] == 'e' || text[index] == 'E')) {
+    index++;
+    negative_exponent = index < length && text[index] == '-';
+    if (index < length && (text[index] == '-' || text[index] == '+')) {
+      index++;
+    }
+    const size_t exponent_digits = parse_digits(text + index, length - index,
+      &exponent, &overflow);
+    if (exponent_digits == 0) {
+      return PARSE_ERROR_TRAILING;
+    }
+    index += exponent_digits;
+  }
+  if (index != length) {
+    return PARSE_ERROR_TRAILING;
+  }
+  const int64_t scale = (negative_exponent ? -(int64_t) exponent
+    : (int64_t) exponent) - (int64_t) fraction_digits;
+  /* Exact when both the mantissa and the power of ten are exact doubles */
+  if (!overflow && exponent <= 22 && mantissa <= (UINT64_C(1) << 53)
+      && scale >= -22 && scale <= 22) {
+    *value = scale < 0 ? (double) mantissa / powers[-scale]
+      : (double) mantissa * powers[scale];
+    *value = negative ? -*value : *value;
+    return 0;
+  }
+  /* strtod expects the decimal point of the current locale */
+  const char point = localeconv()->decimal_point[0];
+  const bool direct = terminated
+    && (point == '.' || memchr(text, '.', length) == NULL);
+  char copy[RESULT_PARSE_MAX_LENGTH + 1];
+  if (!direct) {
+    if (length > RESULT_PARSE_MAX_LENGTH) {
+      return PARSE_ERROR_OVERFLOW;
+    }
+    for (size_t position = 0; position < length; position++) {
+      copy[position] = text[position] == '.' ? point : text[position];
+    }
+    copy[length] = '\0';
+  }
+  const char * converted = direct ? text : copy;
+  char * end = NULL;
+  const int saved = errno;
+  errno = 0;
+  *value = strtod(converted, &end);
+  const bool out_of_range = errno == ERANGE
+    && (*value == HUGE_VAL || *value == -HUGE_VAL);
+  errno = saved;
+  if (end != converted + length) {
+    return PARSE_ERROR_TRAILING;
+  }
+  return out_of_range ? PARSE_ERROR_OVERFLOW : 0;
+}
+
+/**
+ * Parses a `double` from the supplied string.
+ *
+ * The string must consist of an optional `+` or `-` sign, one or more decimal
+ * digits with an optional `.` decimal point, and an optional exponent made of
+ * `e` or `E`, an optional sign, and one or more decimal digits. Infinities and
+ * NaNs are not accepted.
+ *
+ * Numbers whose digits fit in 53 bits and whose decimal exponent is between
+ * -22 and 22 are converted exactly without calling the C library. Other numbers
+ * are converted via `strtod`; the decimal point is always `.`, whatever the
+ * current locale. In the rare locales whose decimal point is not a single
+ * character, such numbers are reported as #PARSE_ERROR_TRAILING.
+ *
+ * @param text The string to parse.
+ * @return A successful result holding the parsed number, or a failed result
+ *   holding a #parse_error.
+ */
+static inline RESULT(double, parse_error) parse_double(const char * text) {
+  double value = 0.0;
+  const int error = parse_real(text, strlen(text), true, &value);
+  if (error != 0) {
+    RESULT(double, parse_error) failure = RESULT_FAILURE((parse_error) error);
+    return failure;
+  }
+  RESULT(double, parse_error) success = RESULT_SUCCESS(value);
+  return success;
+}
+
+#endif
@@ -0,0 +1,129 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Inline failure strings.
+ *
+ * This optional header adds a fixed-capacity string type that can be used as
+ * the failure type of results, so that dynamic failure messages never touch
+ * the heap and can be copied by value.
+ *
+ * ```c
+ * #include <result_string.h>
+ * ```
+ *
+ * @file        result_string.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_STRING_H
+#define RESULT_STRING_H
+
+#include <result.h>
+#include <stdarg.h> /* va_list, va_start, va_end */
+#include <stdio.h> /* vsnprintf */
+
+#ifndef RESULT_STRING_CAPACITY
+
+/**
+ * Returns the capacity in bytes of inline failure strings, including the
+ * terminating null character.
+ *
+ * This value may be overridden by defining `RESULT_STRING_CAPACITY` before
+ * including this header. It MUST be the same in every source file.
+ *
+ * @see result_string
+ */
+#define RESULT_STRING_CAPACITY 48
+
+#endif
+
+/**
+ * A fixed-capacity string stored inline.
+ *
+ * Inline strings can be used as the failure type of results, so that dynamic
+ * failure messages never touch the heap and can be copied by value.
+ *
+ * @see RESULT_FAILURE_STR
+ */
+typedef struct result_string {
+  char _chars[RESULT_STRING_CAPACITY];
+} result_string;
+
+/**
+ * Initializes a new failed result holding a formatted inline string.
+ *
+ * The message is formatted via `vsnprintf` and truncated to fit in
+ * #RESULT_STRING_CAPACITY bytes.
+ *
+ * @pre The failure type of the result MUST be #result_string.
+ *
+ * @b Example:
+ * @snippet example.c result_failure_str
+ *
+ * @param ... The format string, followed by the arguments.
+ * @return A new failed result holding the formatted inline string.
+ *
+ * @see RESULT_STRING_CHARS
+ */
+#define RESULT_FAILURE_STR(...)                                             \
+  RESULT_FAILURE(result_string_format(__VA_ARGS__))
+
+/**
+ * Returns the characters of an inline string.
+ *
+ * @b Example:
+ * @snippet example.c result_failure_str
+ *
+ * @param string The inline string.
+ * @return The null-terminated characters of @b string.
+ *
+ * @see RESULT_FAILURE_STR
+ */
+#define RESULT_STRING_CHARS(string)                                         \
+  ((string)._chars)
+
+/**
+ * Formats an inline string.
+ *
+ * @warning
+ * This function is an implementation detail of #RESULT_FAILURE_STR and SHOULD
+ * NOT be called directly.
+ *
+ * @param format The format string.
+ * @param ... The arguments.
+ * @return The formatted inline string, truncated if necessary.
+ */
+__attribute__((format(printf, 1, 2)))
+static inline result_string result_string_format(const char * format, ...) {
+  result_string string;
+  va_list arguments;
+  va_start(arguments, format);
+  if (vsnprintf(string._chars, sizeof(string._chars), format, arguments) < 0) {
+    string._chars[0] = '\0';
+  }
+  va_end(arguments);
+  return string;
+}
+
+#endif
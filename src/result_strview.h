@@ -0,0 +1,266 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Zero-copy string views for parsing pipelines.
+ *
+ * This optional header adds #strview, a pointer and a length into a borrowed
+ * buffer, along with functions to split, trim and parse views. None of them
+ * allocate memory or copy text, and views do not need to be null-terminated,
+ * so a whole tokenization pipeline can run on a read buffer or a memory-mapped
+ * file.
+ *
+ * Views are regular success values, so they work with the macros in
+ * `result.h`: #strview_trim can be passed to #RESULT_MAP_SUCCESS, and the
+ * parsing functions to #RESULT_FLAT_MAP_SUCCESS.
+ *
+ * ```c
+ * #include <result_strview.h>
+ * ```
+ *
+ * @file        result_strview.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_STRVIEW_H
+#define RESULT_STRVIEW_H
+
+#include <result_parse.h>
+
+#ifndef RESULT_SLICE_TYPE
+#define RESULT_SLICE_TYPE
+
+/**
+ * Represents a read-only sequence of bytes that is not owned.
+ *
+ * @note
+ * This type is shared with `result_mmap.h`, so that slices can be parsed
+ * without conversion.
+ *
+ * @see strview
+ */
+typedef struct slice {
+  const char * _data;
+  size_t _length;
+} slice;
+
+#endif
+
+/**
+ * Represents a read-only sequence of characters that is not owned.
+ *
+ * Views are slices, so the slices and lines of a memory-mapped file can be
+ * split, trimmed and parsed directly.
+ *
+ * @see STRVIEW_DATA
+ * @see STRVIEW_LENGTH
+ */
+typedef slice strview;
+
+RESULT_STRUCT(strview, parse_error);
+
+/**
+ * Returns a pointer to the first character of a view.
+ *
+ * @param view The view.
+ * @return The pointer to the characters of @p view.
+ */
+#define STRVIEW_DATA(view)                                                  \
+  ((view)._data)
+
+/**
+ * Returns the number of characters of a view.
+ *
+ * @param view The view.
+ * @return The length of @p view.
+ */
+#define STRVIEW_LENGTH(view)                                                \
+  ((view)._length)
+
+/**
+ * Creates a view of the supplied characters.
+ *
+ * @param data The characters.
+ * @param length The number of characters.
+ * @return The view.
+ *
+ * @see strview_of
+ */
+static inline strview strview_from(const char * data, size_t length) {
+  return (strview) {._data = data, ._length = length};
+}
+
+/**
+ * Creates a view of the supplied null-terminated string.
+ *
+ * @param text The string.
+ * @return The view, excluding the null character.
+ *
+ * @see strview_from
+ */
+static inline strview strview_of(const char * text) {
+  return strview_from(text, strlen(text));
+}
+
+/**
+ * Checks whether a view has the same characters as a string.
+ *
+ * A view that contains null characters never equals a string.
+ *
+ * @param view The view.
+ * @param text The null-terminated string.
+ * @return `true` if both have the same characters; `false` otherwise.
+ */
+static inline bool strview_equals(strview view, const char * text) {
+  return strlen(text) == view._length
+    && (view._length == 0 || memcmp(view._data, text, view._length) == 0);
+}
+
+/**
+ * Checks whether a character is whitespace for #strview_trim.
+ *
+ * @warning
+ * This function is an implementation detail of #strview_trim and SHOULD NOT be
+ * called directly.
+ *
+ * @param character The character.
+ * @return `true` if @b character is a space, tab, carriage return or line
+ *   feed; `false` otherwise.
+ */
+static inline bool strview_is_space(char character) {
+  return character == ' ' || character == '\t' || character == '\r'
+    || character == '\n';
+}
+
+/**
+ * Removes leading and trailing whitespace from a view.
+ *
+ * Whitespace consists of spaces, tabs, carriage returns and line feeds; null
+ * characters are kept.
+ *
+ * @param view The view to trim.
+ * @return The trimmed view.
+ */
+static inline strview strview_trim(strview view) {
+  while (view._length > 0 && strview_is_space(view._data[0])) {
+    view._data++;
+    view._length--;
+  }
+  while (view._length > 0 && strview_is_space(view._data[view._length - 1])) {
+    view._length--;
+  }
+  return view;
+}
+
+/**
+ * Splits the next token off a view.
+ *
+ * The token extends up to the first @p delimiter, which is skipped; @p rest is
+ * left pointing after it. Consecutive delimiters yield empty tokens. After the
+ * last token has been split off, @p rest is exhausted.
+ *
+ * @b Example:
+ * @snippet example.c strview_split
+ *
+ * @param rest The view to split, updated to the remaining characters.
+ * @param delimiter The character that separates tokens.
+ * @return A successful result holding the token, or a failed result holding
+ *   #PARSE_ERROR_EMPTY if @p rest is exhausted.
+ */
+static inline RESULT(strview, parse_error) strview_split(strview * rest,
+    char delimiter) {
+  if (rest->_data == NULL) {
+    return (RESULT(strview, parse_error)) RESULT_FAILURE(PARSE_ERROR_EMPTY);
+  }
+  const char * end = rest->_length == 0 ? NULL
+    : memchr(rest->_data, delimiter, rest->_length);
+  const strview token = strview_from(rest->_data,
+    end == NULL ? rest->_length : (size_t) (end - rest->_data));
+  *rest = end == NULL ? strview_from(NULL, 0)
+    : strview_from(end + 1, rest->_length - token._length - 1);
+  return (RESULT(strview, parse_error)) RESULT_SUCCESS(token);
+}
+
+/**
+ * Parses an `int` from the supplied view.
+ *
+ * The view is parsed the same way as #parse_int parses a string.
+ *
+ * @param view The view to parse.
+ * @return A successful result holding the parsed number, or a failed result
+ *   holding a #parse_error.
+ */
+static inline RESULT(int, parse_error) strview_parse_int(strview view) {
+  uint64_t magnitude = 0;
+  bool negative = false;
+  const int error = parse_integer(view._data, view._length, INT_MAX,
+    &magnitude, &negative);
+  if (error != 0) {
+    return (RESULT(int, parse_error)) RESULT_FAILURE((parse_error) error);
+  }
+  return (RESULT(int, parse_error)) RESULT_SUCCESS(negative
+    ? (int) (-(int64_t) magnitude) : (int) magnitude);
+}
+
+/**
+ * Parses an `int64_t` from the supplied view.
+ *
+ * The view is parsed the same way as #parse_int64 parses a string.
+ *
+ * @param view The view to parse.
+ * @return A successful result holding the parsed number, or a failed result
+ *   holding a #parse_error.
+ */
+static inline RESULT(int64_t, parse_error) strview_parse_int64(strview view) {
+  uint64_t magnitude = 0;
+  bool negative = false;
+  const int error = parse_integer(view._data, view._length, INT64_MAX,
+    &magnitude, &negative);
+  if (error != 0) {
+    return (RESULT(int64_t, parse_error)) RESULT_FAILURE((parse_error) error);
+  }
+  return (RESULT(int64_t, parse_error)) RESULT_SUCCESS(negative
+    ? (int64_t) (0 - magnitude) : (int64_t) magnitude);
+}
+
+/**
+ * Parses a `double` from the supplied view.
+ *
+ * The view is parsed the same way as #parse_double parses a string. Numbers
+ * that need to be converted via `strtod` and are longer than
+ * #RESULT_PARSE_MAX_LENGTH are reported as #PARSE_ERROR_OVERFLOW.
+ *
+ * @param view The view to parse.
+ * @return A successful result holding the parsed number, or a failed result
+ *   holding a #parse_error.
+ */
+static inline RESULT(double, parse_error) strview_parse_double(strview view) {
+  double value = 0.0;
+  const int error = parse_real(view._data, view._length, false, &value);
+  if (error != 0) {
+    return (RESULT(double, parse_error)) RESULT_FAILURE((parse_error) error);
+  }
+  return (RESULT(double, parse_error)) RESULT_SUCCESS(value);
+}
+
+#endif
@@ -0,0 +1,296 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Thread-local failures.
+ *
+ * This optional header adds results that hold the success value only. Their
+ * failure value is stored in a thread-local slot, much like `errno`, so that
+ * large failure types do not make every result as large as them.
+ *
+ * ```c
+ * #include <result_tls.h>
+ * ```
+ *
+ * @file        result_tls.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_TLS_H
+#define RESULT_TLS_H
+
+#include <result.h>
+
+#ifndef RESULT_TLS_SLOT_SIZE
+
+/**
+ * Returns the size in bytes of the thread-local failure slot.
+ *
+ * This value may be overridden by defining `RESULT_TLS_SLOT_SIZE` before
+ * including this header. It MUST be the same in every source file.
+ *
+ * @see RESULT_STRUCT_TLS
+ */
+#define RESULT_TLS_SLOT_SIZE 256
+
+#endif
+
+/**
+ * Thread-local storage for the last failure of thread-local results.
+ *
+ * The slot is a weak definition, so that the linker merges the copies emitted
+ * by every source file that includes this header into a single one.
+ *
+ * @warning
+ * This variable is an implementation detail of #RESULT_TLS_FAILURE and
+ * #RESULT_TLS_USE_FAILURE and SHOULD NOT be accessed directly.
+ */
+__attribute__((weak)) _Thread_local union result_tls_slot {
+  max_align_t _alignment;
+  unsigned char _bytes[RESULT_TLS_SLOT_SIZE];
+} result_tls_slot;
+
+/**
+ * Returns the type specifier for thread-local results with the supplied success
+ * and failure type names.
+ *
+ * Thread-local results hold the success value only. Their failure value is
+ * stored in a thread-local slot, much like `errno`, so their size is driven by
+ * the success type alone. The slot holds the failure of the last thread-local
+ * result created via #RESULT_TLS_FAILURE in the current thread.
+ *
+ * Thread-local results are created via #RESULT_SUCCESS and #RESULT_TLS_FAILURE,
+ * and their failure values are accessed via #RESULT_TLS_USE_FAILURE, which
+ * reads them as the failure type carried by the result. All other
+ * macros that do not access failure values work with thread-local results too.
+ *
+ * @b Example:
+ * @snippet example.c result_tls
+ *
+ * @param success_type_name The success type name.
+ * @param failure_type_name The failure type name.
+ * @return The type specifier.
+ *
+ * @see RESULT_STRUCT_TLS
+ */
+#define RESULT_TLS(success_type_name, failure_type_name)                    \
+  RESULT(success_type_name, tls_ ## failure_type_name)
+
+/**
+ * Declares a thread-local result struct with the supplied success and failure
+ * types.
+ *
+ * @pre The size of @b failure_type MUST NOT exceed #RESULT_TLS_SLOT_SIZE.
+ *
+ * @b Example:
+ * @snippet example.c result_tls
+ *
+ * @param success_type The success type.
+ * @param failure_type The failure type.
+ * @return The type definition.
+ *
+ * @see RESULT_TLS
+ */
+#define RESULT_STRUCT_TLS(success_type, failure_type)                       \
+  RESULT_STRUCT_TLS_TAG(                                                    \
+    success_type,                                                           \
+    failure_type,                                                           \
+    RESULT_TAG(success_type, tls_ ## failure_type)                          \
+  )
+
+/**
+ * Returns the failure type of a thread-local result.
+ *
+ * Thread-local results carry their failure type in a zero-size member, so that
+ * failure values can be converted to it when they are stored, and read back as
+ * it.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_TLS_FAILURE and
+ * #RESULT_TLS_USE_FAILURE and SHOULD NOT be used directly.
+ *
+ * @param result The thread-local result; it is not evaluated.
+ * @return The failure type.
+ */
+#define RESULT_TLS_FAILURE_TYPE(result)                                     \
+  typeof((result)._failure_type[0]._type)
+
+/**
+ * Returns the failure value of a thread-local result.
+ *
+ * @pre @b result MUST be the last thread-local failure created in the current
+ *   thread.
+ *
+ * @b Example:
+ * @snippet example.c result_tls
+ *
+ * @param result The thread-local result to extract the failure value from.
+ * @return The failure value stored in the thread-local slot.
+ *
+ * @see RESULT_TLS_FAILURE
+ */
+#define RESULT_TLS_USE_FAILURE(result)                                      \
+  (*(const RESULT_TLS_FAILURE_TYPE(result) *)                               \
+    (const void *) result_tls_slot._bytes)
+
+/**
+ * Stores a failure value in the thread-local slot.
+ *
+ * The failure value is converted to the failure type of the result first.
+ *
+ * @warning
+ * This macro is an implementation detail of #RESULT_TLS_FAILURE and SHOULD NOT
+ * be used directly.
+ *
+ * @param result_type The type of the thread-local result.
+ * @param failure The failure value.
+ * @return `true`.
+ */
+#define RESULT_TLS_STORE(result_type, failure)                              \
+  (memcpy(                                                                  \
+    result_tls_slot._bytes,                                                 \
+    (RESULT_TLS_FAILURE_TYPE(*(result_type *) 0) []) {(failure)},           \
+    sizeof(RESULT_TLS_FAILURE_TYPE(*(result_type *) 0))                     \
+  ), true)
+
+#ifndef NDEBUG
+
+/**
+ * Initializes a new thread-local result containing a failure value.
+ *
+ * The failure value is converted to the failure type of the result and stored
+ * in the thread-local slot, overwriting any failure stored previously in the
+ * current thread.
+ *
+ * @b Example:
+ * @snippet example.c result_tls
+ *
+ * @param result_type The type of the thread-local result.
+ * @param failure The failure value.
+ * @return A new thread-local result containing the supplied failure value.
+ *
+ * @see RESULT_TLS_USE_FAILURE
+ */
+#define RESULT_TLS_FAILURE(result_type, failure)                            \
+  {                                                                         \
+    ._failed = RESULT_TLS_STORE(result_type, failure),                      \
+    ._debug = RESULT_DEBUG_HERE                                             \
+  }
+
+/**
+ * Declares a thread-local result struct with the supplied success and failure
+ * types.
+ *
+ * @pre The size of @b failure_type MUST NOT exceed #RESULT_TLS_SLOT_SIZE.
+ * @pre @b struct_tag SHOULD be generated via #RESULT_TAG.
+ *
+ * @warning
+ * The exact sequence of members that make up a result struct MUST be considered
+ * part of the implementation details. Results SHOULD only be created and
+ * accessed using the macros provided in this header file.
+ *
+ * @param success_type The success type.
+ * @param failure_type The failure type.
+ * @param struct_tag The struct tag.
+ * @return The struct declaration.
+ *
+ * @see RESULT_STRUCT_TLS
+ * @see RESULT_TAG
+ */
+#define RESULT_STRUCT_TLS_TAG(success_type, failure_type, struct_tag)       \
+  struct struct_tag {                                                       \
+    bool _failed;                                                           \
+    union {                                                                 \
+      success_type _success;                                                \
+    } _value;                                                               \
+    RESULT_DEBUG_INFO _debug;                                               \
+    __extension__ struct __attribute__((packed)) {                          \
+      failure_type _type;                                                   \
+    } _failure_type[0];                                                     \
+    _Static_assert(                                                         \
+      sizeof(failure_type) <= RESULT_TLS_SLOT_SIZE,                         \
+      "Thread-local failure types must fit in the thread-local slot"        \
+    );                                                                      \
+  }
+
+#else
+
+/**
+ * Initializes a new thread-local result containing a failure value.
+ *
+ * The failure value is converted to the failure type of the result and stored
+ * in the thread-local slot, overwriting any failure stored previously in the
+ * current thread.
+ *
+ * @b Example:
+ * @snippet example.c result_tls
+ *
+ * @param result_type The type of the thread-local result.
+ * @param failure The failure value.
+ * @return A new thread-local result containing the supplied failure value.
+ *
+ * @see RESULT_TLS_USE_FAILURE
+ */
+#define RESULT_TLS_FAILURE(result_type, failure)                            \
+  {                                                                         \
+    ._failed = RESULT_TLS_STORE(result_type, failure)                       \
+  }
+
+/**
+ * Declares a thread-local result struct with the supplied success and failure
+ * types.
+ *
+ * @pre The size of @b failure_type MUST NOT exceed #RESULT_TLS_SLOT_SIZE.
+ * @pre @b struct_tag SHOULD be generated via #RESULT_TAG.
+ *
+ * @warning
+ * The exact sequence of members that make up a result struct MUST be considered
+ * part of the implementation details. Results SHOULD only be created and
+ * accessed using the macros provided in this header file.
+ *
+ * @param success_type The success type.
+ * @param failure_type The failure type.
+ * @param struct_tag The struct tag.
+ * @return The struct declaration.
+ *
+ * @see RESULT_STRUCT_TLS
+ * @see RESULT_TAG
+ */
+#define RESULT_STRUCT_TLS_TAG(success_type, failure_type, struct_tag)       \
+  struct struct_tag {                                                       \
+    bool _failed;                                                           \
+    union {                                                                 \
+      success_type _success;                                                \
+    } _value;                                                               \
+    __extension__ struct __attribute__((packed)) {                          \
+      failure_type _type;                                                   \
+    } _failure_type[0];                                                     \
+    _Static_assert(                                                         \
+      sizeof(failure_type) <= RESULT_TLS_SLOT_SIZE,                         \
+      "Thread-local failure types must fit in the thread-local slot"        \
+    );                                                                      \
+  }
+
+#endif
+
+#endif
@@ -0,0 +1,639 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Batched I/O that yields one result per operation.
+ *
+ * This optional header queues many reads and submits them at once, producing
+ * a batch of results in submission order. On Linux, the batch is submitted
+ * through an `io_uring` instance with a single system call per batch. Where
+ * `io_uring` is unavailable (older kernels, or sandboxes that forbid it), the
+ * batch is executed by a small pool of threads calling #io_pread.
+ *
+ * ```c
+ * #include <result_uring.h>
+ * ```
+ *
+ * @file        result_uring.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_URING_H
+#define RESULT_URING_H
+
+#include <pthread.h> /* pthread_create, pthread_mutex_t, pthread_cond_t */
+#include <stdlib.h> /* calloc, free */
+#include <result_io.h>
+
+#ifdef __linux__
+#include <linux/io_uring.h> /* struct io_uring_params, struct io_uring_sqe */
+#include <sys/syscall.h> /* SYS_io_uring_setup, SYS_io_uring_enter, ... */
+#endif
+
+#ifndef RESULT_URING_ENTRIES
+
+/**
+ * Returns the maximum number of operations submitted to `io_uring` at once.
+ *
+ * Larger batches are submitted in several rounds. This value may be overridden
+ * by defining `RESULT_URING_ENTRIES` before including this header.
+ */
+#define RESULT_URING_ENTRIES 256
+
+#endif
+
+#ifndef RESULT_URING_THREADS
+
+/**
+ * Returns the number of threads that execute batches when `io_uring` is
+ * unavailable.
+ *
+ * This value may be overridden by defining `RESULT_URING_THREADS` before
+ * including this header.
+ */
+#define RESULT_URING_THREADS 4
+
+#endif
+
+/**
+ * Represents how a batch executes its operations.
+ */
+enum io_batch_mode {
+  /** Use `io_uring` if available, or fall back to a thread pool. */
+  IO_BATCH_AUTO,
+  /** Always use a thread pool. */
+  IO_BATCH_THREADS
+};
+
+/**
+ * Represents a queued read operation.
+ *
+ * @warning
+ * The members of this struct are implementation details.
+ */
+struct io_batch_operation {
+  int _descriptor;
+  void * _buffer;
+  size_t _count;
+  off_t _offset;
+};
+
+/**
+ * Represents a batch of read operations and their results.
+ *
+ * @warning
+ * The members of this struct are implementation details. Batches SHOULD only
+ * be accessed via the functions provided in this header file.
+ *
+ * @see io_batch_init
+ */
+struct io_batch {
+  size_t _capacity;
+  size_t _count;
+  struct io_batch_operation * _operations;
+  RESULT(ssize_t, io_error) * _results;
+  int _ring;
+  struct {
+    void * _sq_ring;
+    void * _cq_ring;
+    void * _sqes;
+    size_t _sq_ring_size;
+    size_t _cq_ring_size;
+    size_t _sqes_size;
+    unsigned _entries;
+    unsigned * _sq_head;
+    unsigned * _sq_tail;
+    unsigned * _sq_mask;
+    unsigned * _sq_array;
+    unsigned * _cq_head;
+    unsigned * _cq_tail;
+    unsigned * _cq_mask;
+    void * _cqes;
+  } _uring;
+  struct {
+    pthread_t _workers[RESULT_URING_THREADS];
+    size_t _started;
+    pthread_mutex_t _lock;
+    pthread_cond_t _work;
+    pthread_cond_t _done;
+    size_t _next;
+    size_t _submitted;
+    size_t _pending;
+    bool _stopping;
+  } _pool;
+};
+
+/**
+ * Executes queued operations until the batch is stopped.
+ *
+ * @warning
+ * This function is an implementation detail of #io_batch_init and SHOULD NOT be
+ * called directly.
+ *
+ * @param argument The batch.
+ * @return `NULL`.
+ */
+static inline void * io_batch_worker(void * argument) {
+  struct io_batch * batch = argument;
+  (void) pthread_mutex_lock(&batch->_pool._lock);
+  for (;;) {
+    while (!batch->_pool._stopping
+        && batch->_pool._next >= batch->_pool._submitted) {
+      (void) pthread_cond_wait(&batch->_pool._work, &batch->_pool._lock);
+    }
+    if (batch->_pool._stopping) {
+      break;
+    }
+    const size_t index = batch->_pool._next++;
+    (void) pthread_mutex_unlock(&batch->_pool._lock);
+    const struct io_batch_operation * operation = &batch->_operations[index];
+    batch->_results[index] = io_pread(operation->_descriptor,
+      operation->_buffer, operation->_count, operation->_offset);
+    (void) pthread_mutex_lock(&batch->_pool._lock);
+    if (--batch->_pool._pending == 0) {
+      (void) pthread_cond_signal(&batch->_pool._done);
+    }
+  }
+  (void) pthread_mutex_unlock(&batch->_pool._lock);
+  return NULL;
+}
+
+/**
+ * Starts the thread pool of a batch.
+ *
+ * @warning
+ * This function is an implementation detail of #io_batch_init and SHOULD NOT be
+ * called directly.
+ *
+ * @param batch The batch.
+ * @return `0` if at least one thread was started; an `errno` code otherwise.
+ */
+static inline int io_batch_pool_start(struct io_batch * batch) {
+  (void) pthread_mutex_init(&batch->_pool._lock, NULL);
+  (void) pthread_cond_init(&batch->_pool._work, NULL);
+  (void) pthread_cond_init(&batch->_pool._done, NULL);
+  for (size_t index = 0; index < RESULT_URING_THREADS; index++) {
+    const int error = pthread_create(&batch->_pool._workers[index], NULL,
+      io_batch_worker, batch);
+    if (error != 0) {
+      if (batch->_pool._started == 0) {
+        (void) pthread_cond_destroy(&batch->_pool._done);
+        (void) pthread_cond_destroy(&batch->_pool._work);
+        (void) pthread_mutex_destroy(&batch->_pool._lock);
+        return error;
+      }
+      break;
+    }
+    batch->_pool._started++;
+  }
+  return 0;
+}
+
+/**
+ * Executes a range of queued operations in the thread pool of a batch and
+ * waits for all of them to complete.
+ *
+ * @warning
+ * This function is an implementation detail of #io_batch_submit and SHOULD NOT
+ * be called directly.
+ *
+ * @param batch The batch.
+ * @param first The index of the first operation to execute.
+ * @param count One past the index of the last operation to execute.
+ */
+static inline void io_batch_pool_run(struct io_batch * batch, size_t first,
+    size_t count) {
+  (void) pthread_mutex_lock(&batch->_pool._lock);
+  batch->_pool._next = first;
+  batch->_pool._submitted = count;
+  batch->_pool._pending = count - first;
+  (void) pthread_cond_broadcast(&batch->_pool._work);
+  while (batch->_pool._pending > 0) {
+    (void) pthread_cond_wait(&batch->_pool._done, &batch->_pool._lock);
+  }
+  batch->_pool._submitted = 0;
+  (void) pthread_mutex_unlock(&batch->_pool._lock);
+}
+
+#ifdef __linux__
+
+/**
+ * Checks whether an `io_uring` instance supports read operations.
+ *
+ * `IORING_OP_READ` and `IORING_REGISTER_PROBE` were both introduced in Linux
+ * 5.6, so older kernels fail the probe and the batch falls back to a thread
+ * pool, instead of failing every operation with `EINVAL`.
+ *
+ * @warning
+ * This function is an implementation detail of #io_batch_init and SHOULD NOT be
+ * called directly.
+ *
+ * @param ring The `io_uring` file descriptor.
+ * @return `true` if `IORING_OP_READ` is supported; `false` otherwise.
+ */
+static inline bool io_batch_uring_probe(int ring) {
+  struct io_uring_probe * probe = calloc(1, sizeof(*probe)
+    + (IORING_OP_READ + 1) * sizeof(probe->ops[0]));
+  if (probe == NULL) {
+    return false;
+  }
+  const bool supported = syscall(SYS_io_uring_register, ring,
+      IORING_REGISTER_PROBE, probe, IORING_OP_READ + 1) == 0
+    && probe->last_op >= IORING_OP_READ
+    && (probe->ops[IORING_OP_READ].flags & IO_URING_OP_SUPPORTED) != 0;
+  free(probe);
+  return supported;
+}
+
+/**
+ * Sets up the `io_uring` instance of a batch.
+ *
+ * @warning
+ * This function is an implementation detail of #io_batch_init and SHOULD NOT be
+ * called directly.
+ *
+ * @param batch The batch.
+ * @return `true` if `io_uring` is available; `false` otherwise.
+ */
+static inline bool io_batch_uring_setup(struct io_batch * batch) {
+  struct io_uring_params params = {0};
+  const unsigned entries = batch->_capacity < RESULT_URING_ENTRIES
+    ? (unsigned) batch->_capacity : RESULT_URING_ENTRIES;
+  const int ring = (int) syscall(SYS_io_uring_setup, entries, &params);
+  if (ring < 0) {
+    return false;
+  }
+  if (!io_batch_uring_probe(ring)) {
+    (void) close(ring);
+    return false;
+  }
+  batch->_uring._sq_ring_size = params.sq_off.array
+    + params.sq_entries * sizeof(unsigned);
+  batch->_uring._cq_ring_size = params.cq_off.cqes
+    + params.cq_entries * sizeof(struct io_uring_cqe);
+  batch->_uring._sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  if (params.features & IORING_FEAT_SINGLE_MMAP) {
+    if (batch->_uring._cq_ring_size > batch->_uring._sq_ring_size) {
+      batch->_uring._sq_ring_size = batch->_uring._cq_ring_size;
+    }
+    batch->_uring._cq_ring_size = 0;
+  }
+  unsigned char * sq_ring = mmap(NULL, batch->_uring._sq_ring_size,
+    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring,
+    IORING_OFF_SQ_RING);
+  unsigned char * cq_ring = batch->_uring._cq_ring_size == 0 ? sq_ring
+    : mmap(NULL, batch->_uring._cq_ring_size, PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_CQ_RING);
+  void * sqes = mmap(NULL, batch->_uring._sqes_size, PROT_READ | PROT_WRITE,
+    MAP_SHARED | MAP_POPULATE, ring, IORING_OFF_SQES);
+  if (sq_ring == MAP_FAILED || cq_ring == MAP_FAILED || sqes == MAP_FAILED) {
+    if (sqes != MAP_FAILED) {
+      (void) munmap(sqes, batch->_uring._sqes_size);
+    }
+    if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+      (void) munmap(cq_ring, batch->_uring._cq_ring_size);
+    }
+    if (sq_ring != MAP_FAILED) {
+      (void) munmap(sq_ring, batch->_uring._sq_ring_size);
+    }
+    (void) close(ring);
+    return false;
+  }
+  batch->_ring = ring;
+  batch->_uring._sq_ring = sq_ring;
+  batch->_uring._cq_ring = cq_ring;
+  batch->_uring._sqes = sqes;
+  batch->_uring._entries = params.sq_entries;
+  batch->_uring._sq_head = (unsigned *) (sq_ring + params.sq_off.head);
+  batch->_uring._sq_tail = (unsigned *) (sq_ring + params.sq_off.tail);
+  batch->_uring._sq_mask = (unsigned *) (sq_ring + params.sq_off.ring_mask);
+  batch->_uring._sq_array = (unsigned *) (sq_ring + params.sq_off.array);
+  batch->_uring._cq_head = (unsigned *) (cq_ring + params.cq_off.head);
+  batch->_uring._cq_tail = (unsigned *) (cq_ring + params.cq_off.tail);
+  batch->_uring._cq_mask = (unsigned *) (cq_ring + params.cq_off.ring_mask);
+  batch->_uring._cqes = cq_ring + params.cq_off.cqes;
+  return true;
+}
+
+/**
+ * Returns the result of an operation completed by `io_uring`.
+ *
+ * A completion that comes up short or fails is finished via #io_pread, from
+ * where it stopped, so that operations give the same results as in a thread
+ * pool: short reads are resumed, and `EINTR` is retried.
+ *
+ * @warning
+ * This function is an implementation detail of #io_batch_submit and SHOULD NOT
+ * be called directly.
+ *
+ * @param operation The operation.
+ * @param completed The result of the completion: a number of bytes, or a
+ *   negated `errno` code.
+ * @return A successful result holding the number of bytes read, or a failed
+ *   result holding the `errno` code.
+ */
+static inline RESULT(ssize_t, io_error) io_batch_uring_result(
+    const struct io_batch_operation * operation, int completed) {
+  if (completed == 0 || (completed > 0
+      && (size_t) completed == operation->_count)) {
+    return (RESULT(ssize_t, io_error)) RESULT_SUCCESS((ssize_t) completed);
+  }
+  const size_t done = completed > 0 ? (size_t) completed : 0;
+  const RESULT(ssize_t, io_error) rest = io_pread(operation->_descriptor,
+    (char *) operation->_buffer + done, operation->_count - done,
+    operation->_offset + (off_t) done);
+  if (done == 0) {
+    return rest;
+  }
+  return (RESULT(ssize_t, io_error)) RESULT_SUCCESS((ssize_t) done
+    + (RESULT_HAS_SUCCESS(rest) ? RESULT_USE_SUCCESS(rest) : 0));
+}
+
+/**
+ * Submits a round of queued operations to `io_uring` and reaps their results.
+ *
+ * If `io_uring_enter` fails, the entries that the kernel has not consumed yet
+ * are withdrawn, and the operations already in flight are waited for, so that
+ * the ring is left empty and no buffer is written after this function returns.
+ *
+ * @warning
+ * This function is an implementation detail of #io_batch_submit and SHOULD NOT
+ * be called directly.
+ *
+ * @param batch The batch.
+ * @param first The index of the first operation of the round.
+ * @param count The number of operations of the round.
+ * @return `0` if the round was executed; an `errno` code otherwise.
+ */
+static inline int io_batch_uring_round(struct io_batch * batch, size_t first,
+    unsigned count) {
+  struct io_uring_sqe * sqes = batch->_uring._sqes;
+  const struct io_uring_cqe * cqes = batch->_uring._cqes;
+  const unsigned sq_mask = *batch->_uring._sq_mask;
+  const unsigned cq_mask = *batch->_uring._cq_mask;
+  const unsigned start = *batch->_uring._sq_tail;
+  unsigned tail = start;
+  for (unsigned offset = 0; offset < count; offset++, tail++) {
+    const struct io_batch_operation * operation =
+      &batch->_operations[first + offset];
+    const unsigned slot = tail & sq_mask;
+    sqes[slot] = (struct io_uring_sqe) {
+      .opcode = IORING_OP_READ,
+      .fd = operation->_descriptor,
+      .off = (uint64_t) operation->_offset,
+      .addr = (uint64_t) (uintptr_t) operation->_buffer,
+      .len = operation->_count > UINT32_MAX
+        ? UINT32_MAX : (uint32_t) operation->_count,
+      .user_data = first + offset
+    };
+    batch->_uring._sq_array[slot] = slot;
+  }
+  __atomic_store_n(batch->_uring._sq_tail, tail, __ATOMIC_RELEASE);
+  unsigned completed = 0;
+  int error = 0;
+  for (;;) {
+    const unsigned submitted =
+      __atomic_load_n(batch->_uring._sq_head, __ATOMIC_ACQUIRE) - start;
+    const unsigned expected = error == 0 ? count : submitted;
+    if (completed == expected) {
+      break;
+    }
+    const long entered = syscall(SYS_io_uring_enter, batch->_ring,
+      error == 0 ? count - submitted : 0, expected - completed,
+      IORING_ENTER_GETEVENTS, NULL, 0);
+    if (entered < 0 && errno != EINTR && error == 0) {
+      /* Without a polling thread, the kernel only consumes entries here */
+      error = errno;
+      __atomic_store_n(batch->_uring._sq_tail,
+        __atomic_load_n(batch->_uring._sq_head, __ATOMIC_ACQUIRE),
+        __ATOMIC_RELEASE);
+    }
+    unsigned head = *batch->_uring._cq_head;
+    while (head != __atomic_load_n(batch->_uring._cq_tail, __ATOMIC_ACQUIRE)) {
+      const struct io_uring_cqe * cqe = &cqes[head & cq_mask];
+      batch->_results[cqe->user_data] = io_batch_uring_result(
+        &batch->_operations[cqe->user_data], cqe->res);
+      head++;
+      completed++;
+    }
+    __atomic_store_n(batch->_uring._cq_head, head, __ATOMIC_RELEASE);
+  }
+  return error;
+}
+
+/**
+ * Releases the `io_uring` instance of a batch.
+ *
+ * @warning
+ * This function is an implementation detail of #io_batch_submit and SHOULD NOT
+ * be called directly.
+ *
+ * @param batch The batch.
+ */
+static inline void io_batch_uring_close(struct io_batch * batch) {
+  (void) munmap(batch->_uring._sqes, batch->_uring._sqes_size);
+  if (batch->_uring._cq_ring != batch->_uring._sq_ring) {
+    (void) munmap(batch->_uring._cq_ring, batch->_uring._cq_ring_size);
+  }
+  (void) munmap(batch->_uring._sq_ring, batch->_uring._sq_ring_size);
+  (void) close(batch->_ring);
+  batch->_ring = -1;
+}
+
+#endif
+
+/**
+ * Initializes a batch that can hold the supplied number of operations.
+ *
+ * @b Example:
+ * @snippet example.c io_batch
+ *
+ * @param batch The batch to initialize.
+ * @param capacity The maximum number of queued operations.
+ * @param mode How the batch executes its operations.
+ * @return A successful result, or a failed result holding the `errno` code.
+ *
+ * @see io_batch_destroy
+ */
+static inline RESULT_VOID(io_error) io_batch_init(struct io_batch * batch,
+    size_t capacity, enum io_batch_mode mode) {
+  *batch = (struct io_batch) {._capacity = capacity, ._ring = -1};
+  batch->_operations = calloc(capacity, sizeof(*batch->_operations));
+  batch->_results = calloc(capacity, sizeof(*batch->_results));
+  if (batch->_operations == NULL || batch->_results == NULL) {
+    free(batch->_operations);
+    free(batch->_results);
+    return (RESULT_VOID(io_error)) RESULT_FAILURE(ENOMEM);
+  }
+#ifdef __linux__
+  if (mode == IO_BATCH_AUTO && capacity > 0 && io_batch_uring_setup(batch)) {
+    return (RESULT_VOID(io_error)) RESULT_VOID_SUCCESS();
+  }
+#else
+  (void) mode;
+#endif
+  const int error = io_batch_pool_start(batch);
+  if (error != 0) {
+    free(batch->_operations);
+    free(batch->_results);
+    return (RESULT_VOID(io_error)) RESULT_FAILURE(error);
+  }
+  return (RESULT_VOID(io_error)) RESULT_VOID_SUCCESS();
+}
+
+/**
+ * Releases the resources held by a batch.
+ *
+ * @param batch The batch to destroy.
+ *
+ * @see io_batch_init
+ */
+static inline void io_batch_destroy(struct io_batch * batch) {
+#ifdef __linux__
+  if (batch->_ring >= 0) {
+    io_batch_uring_close(batch);
+  }
+#endif
+  if (batch->_pool._started > 0) {
+    (void) pthread_mutex_lock(&batch->_pool._lock);
+    batch->_pool._stopping = true;
+    (void) pthread_cond_broadcast(&batch->_pool._work);
+    (void) pthread_mutex_unlock(&batch->_pool._lock);
+    for (size_t index = 0; index < batch->_pool._started; index++) {
+      (void) pthread_join(batch->_pool._workers[index], NULL);
+    }
+    (void) pthread_cond_destroy(&batch->_pool._done);
+    (void) pthread_cond_destroy(&batch->_pool._work);
+    (void) pthread_mutex_destroy(&batch->_pool._lock);
+  }
+  free(batch->_operations);
+  free(batch->_results);
+}
+
+/**
+ * Checks whether a batch is submitted through `io_uring`.
+ *
+ * @param batch The batch.
+ * @return `true` if the batch uses `io_uring`; `false` if it uses a thread
+ *   pool.
+ */
+static inline bool io_batch_uses_uring(const struct io_batch * batch) {
+  return batch->_ring >= 0;
+}
+
+/**
+ * Queues a read operation.
+ *
+ * @param batch The batch.
+ * @param descriptor The file descriptor.
+ * @param buffer The buffer to read into.
+ * @param count The number of bytes to read.
+ * @param offset The file offset to read from.
+ * @return `true` if the operation was queued; `false` if the batch is full.
+ *
+ * @note
+ * Like #io_pread, each operation reads until @b count bytes have been read,
+ * the end of the file is reached, or an error occurs, whether the batch uses
+ * `io_uring` or a thread pool.
+ *
+ * @see io_batch_submit
+ */
+static inline bool io_batch_pread(struct io_batch * batch, int descriptor,
+    void * buffer, size_t count, off_t offset) {
+  if (batch->_count == batch->_capacity) {
+    return false;
+  }
+  batch->_operations[batch->_count++] = (struct io_batch_operation) {
+    ._descriptor = descriptor,
+    ._buffer = buffer,
+    ._count = count,
+    ._offset = offset
+  };
+  return true;
+}
+
+/**
+ * Executes the queued operations and waits for all of them to complete.
+ *
+ * The result of each operation can then be retrieved via #io_batch_result,
+ * and the queue is emptied, so that a new batch of operations can be queued.
+ *
+ * If `io_uring` fails, the batch switches to a thread pool, which executes the
+ * remaining operations of this and all subsequent submissions.
+ *
+ * @param batch The batch.
+ * @return A successful result holding the number of executed operations, or a
+ *   failed result holding the `errno` code if no thread could be started.
+ *
+ * @see io_batch_result
+ */
+static inline RESULT(ssize_t, io_error) io_batch_submit(
+    struct io_batch * batch) {
+  const size_t count = batch->_count;
+  size_t first = 0;
+  batch->_count = 0;
+#ifdef __linux__
+  if (batch->_ring >= 0) {
+    for (; first < count; first += batch->_uring._entries) {
+      const size_t remaining = count - first;
+      const int error = io_batch_uring_round(batch, first,
+        remaining < batch->_uring._entries
+          ? (unsigned) remaining : batch->_uring._entries);
+      if (error != 0) {
+        /* The round was drained, so it can be run again in a thread pool */
+        io_batch_uring_close(batch);
+        break;
+      }
+    }
+    if (first >= count) {
+      return (RESULT(ssize_t, io_error)) RESULT_SUCCESS((ssize_t) count);
+    }
+  }
+#endif
+  if (batch->_pool._started == 0) {
+    const int error = io_batch_pool_start(batch);
+    if (error != 0) {
+      return (RESULT(ssize_t, io_error)) RESULT_FAILURE(error);
+    }
+  }
+  io_batch_pool_run(batch, first, count);
+  return (RESULT(ssize_t, io_error)) RESULT_SUCCESS((ssize_t) count);
+}
+
+/**
+ * Returns the result of an executed operation.
+ *
+ * @pre @b index MUST be less than the number of operations executed by the
+ *   last call to #io_batch_submit.
+ *
+ * @param batch The batch.
+ * @param index The index of the operation, in submission order.
+ * @return A successful result holding the number of bytes read, or a failed
+ *   result holding the `errno` code.
+ */
+static inline RESULT(ssize_t, io_error) io_batch_result(
+    const struct io_batch * batch, size_t index) {
+  return batch->_results[index];
+}
+
+#endif
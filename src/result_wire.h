@@ -0,0 +1,547 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * Compact binary wire format for results.
+ *
+ * This optional header encodes results into byte buffers so that they can be
+ * sent to other processes through pipes or sockets, and decodes them back. An
+ * encoded result consists of:
+ *
+ * - A tag byte: #WIRE_TAG_SUCCESS or #WIRE_TAG_FAILURE.
+ * - For failed results, the failure value as a zigzag-encoded varint.
+ * - For successful results, the success value as written by a user codec.
+ *
+ * Neither padding nor debug information is encoded, so the same bytes are
+ * produced whether @p NDEBUG is defined or not.
+ *
+ * ```c
+ * #include <result_wire.h>
+ * ```
+ *
+ * @file        result_wire.h
+ * @version     1.0.0
+ * @author      [Guillermo Calvo]
+ * @copyright   Licensed under [Apache 2.0]
+ * @see         For more information, visit the [project on GitHub]
+ *
+ * [Guillermo Calvo]: https://guillermo.dev
+ * [Apache 2.0]: http://www.apache.org/licenses/LICENSE-2.0
+ * [project on GitHub]: https://github.com/guillermocalvo/resultlib
+ */
+
+#ifndef RESULT_WIRE_H
+#define RESULT_WIRE_H
+
+#include <result.h>
+
+/**
+ * Represents the reason why a result could not be encoded or decoded.
+ */
+typedef enum wire_error {
+  /** The buffer has no space left for the encoded bytes. */
+  WIRE_ERROR_NO_SPACE = 1,
+  /** The buffer ends in the middle of an encoded value. */
+  WIRE_ERROR_TRUNCATED,
+  /** The tag byte is neither a success nor a failure tag. */
+  WIRE_ERROR_INVALID_TAG,
+  /** The decoded value does not fit in its type. */
+  WIRE_ERROR_OVERFLOW
+} wire_error;
+
+/**
+ * Represents the address of some bytes within a buffer.
+ */
+typedef const void * wire_pointer;
+
+RESULT_STRUCT_VOID(wire_error);
+
+RESULT_STRUCT(uint64_t, wire_error);
+
+RESULT_STRUCT(size_t, wire_error);
+
+RESULT_STRUCT(wire_pointer, wire_error);
+
+/**
+ * The tag byte of an encoded successful result.
+ */
+#define WIRE_TAG_SUCCESS 0x00
+
+/**
+ * The tag byte of an encoded failed result.
+ */
+#define WIRE_TAG_FAILURE 0x01
+
+/**
+ * The maximum number of bytes of an encoded varint.
+ */
+#define WIRE_VARINT_MAX_SIZE 10
+
+/**
+ * Represents a buffer that encoded bytes are appended to.
+ *
+ * @warning
+ * The members of this struct are implementation details. Writers SHOULD only
+ * be accessed via the functions provided in this header file.
+ *
+ * @see wire_writer_init
+ */
+struct wire_writer {
+  uint8_t * _data;
+  size_t _capacity;
+  size_t _length;
+};
+
+/**
+ * Represents a buffer that encoded bytes are consumed from.
+ *
+ * @warning
+ * The members of this struct are implementation details. Readers SHOULD only
+ * be accessed via the functions provided in this header file.
+ *
+ * @see wire_reader_init
+ */
+struct wire_reader {
+  const uint8_t * _data;
+  size_t _length;
+  size_t _position;
+};
+
+/**
+ * Creates a writer that appends to the supplied buffer.
+ *
+ * @param data The buffer.
+ * @param capacity The size in bytes of the buffer.
+ * @return The writer.
+ */
+static inline struct wire_writer wire_writer_init(void * data,
+    size_t capacity) {
+  return (struct wire_writer) {._data = data, ._capacity = capacity};
+}
+
+/**
+ * Returns the number of bytes written so far.
+ *
+ * @param writer The writer.
+ * @return The number of bytes written to @p writer.
+ */
+static inline size_t wire_writer_length(const struct wire_writer * writer) {
+  return writer->_length;
+}
+
+/**
+ * Creates a reader that consumes the supplied buffer.
+ *
+ * @warning
+ * The buffer MUST outlive the pointers obtained via #wire_read_bytes.
+ *
+ * @param data The buffer.
+ * @param length The number of bytes in the buffer.
+ * @return The reader.
+ */
+static inline struct wire_reader wire_reader_init(const void * data,
+    size_t length) {
+  return (struct wire_reader) {._data = data, ._length = length};
+}
+
+/**
+ * Returns the number of bytes that have not been read yet.
+ *
+ * @param reader The reader.
+ * @return The number of bytes left in @p reader.
+ */
+static inline size_t wire_reader_remaining(const struct wire_reader * reader) {
+  return reader->_length - reader->_position;
+}
+
+/**
+ * Writes an unsigned integer as a varint.
+ *
+ * Varints take seven bits per byte, least significant group first, and set the
+ * high bit of every byte but the last one.
+ *
+ * @param writer The writer.
+ * @param value The integer to write.
+ * @return A successful result, or a failed result holding
+ *   #WIRE_ERROR_NO_SPACE.
+ */
+static inline RESULT_VOID(wire_error) wire_write_varint(
+    struct wire_writer * writer, uint64_t value) {
+  uint8_t bytes[WIRE_VARINT_MAX_SIZE];
+  size_t length = 0;
+  while (value >= 0x80) {
+    bytes[length++] = (uint8_t) (value | 0x80);
+    value >>= 7;
+  }
+  bytes[length++] = (uint8_t) value;
+  if (length > writer->_capacity - writer->_length) {
+    return (RESULT_VOID(wire_error)) RESULT_FAILURE(WIRE_ERROR_NO_SPACE);
+  }
+  memcpy(writer->_data + writer->_length, bytes, length);
+  writer->_length += length;
+  return (RESULT_VOID(wire_error)) RESULT_VOID_SUCCESS();
+}
+
+/**
+ * Reads an unsigned integer encoded as a varint.
+ *
+ * @param reader The reader.
+ * @return A successful result holding the integer, or a failed result holding
+ *   #WIRE_ERROR_TRUNCATED or #WIRE_ERROR_OVERFLOW.
+ */
+static inline RESULT(uint64_t, wire_error) wire_read_varint(
+    struct wire_reader * reader) {
+  uint64_t value = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    if (reader->_position >= reader->_length) {
+      return (RESULT(uint64_t, wire_error))
+        RESULT_FAILURE(WIRE_ERROR_TRUNCATED);
+    }
+    const uint8_t byte = reader->_data[reader->_position++];
+    if (shift == 63 && byte > 1) {
+      return (RESULT(uint64_t, wire_error)) RESULT_FAILURE(WIRE_ERROR_OVERFLOW);
+    }
+    value |= (uint64_t) (byte & 0x7F) << shift;
+    if (byte < 0x80) {
+      return (RESULT(uint64_t, wire_error)) RESULT_SUCCESS(value);
+    }
+  }
+  return (RESULT(uint64_t, wire_error)) RESULT_FAILURE(WIRE_ERROR_OVERFLOW);
+}
+
+/**
+ * Writes some bytes verbatim.
+ *
+ * @param writer The writer.
+ * @param data The bytes to write.
+ * @param length The number of bytes to write.
+ * @return A successful result, or a failed result holding
+ *   #WIRE_ERROR_NO_SPACE.
+ */
+static inline RESULT_VOID(wire_error) wire_write_bytes(
+    struct wire_writer * writer, const void * data, size_t length) {
+  if (length > writer->_capacity - writer->_length) {
+    return (RESULT_VOID(wire_error)) RESULT_FAILURE(WIRE_ERROR_NO_SPACE);
+  }
+  if (length > 0) {
+    memcpy(writer->_data + writer->_length, data, length);
+  }
+  writer->_length += length;
+  return (RESULT_VOID(wire_error)) RESULT_VOID_SUCCESS();
+}
+
+/**
+ * Reads some bytes without copying them.
+ *
+ * @param reader The reader.
+ * @param length The number of bytes to read.
+ * @return A successful result holding a pointer to the bytes within the buffer
+ *   of @p reader, or a failed result holding #WIRE_ERROR_TRUNCATED.
+ */
+static inline RESULT(wire_pointer, wire_error) wire_read_bytes(
+    struct wire_reader * reader, size_t length) {
+  if (length > reader->_length - reader->_position) {
+    return (RESULT(wire_pointer, wire_error))
+      RESULT_FAILURE(WIRE_ERROR_TRUNCATED);
+  }
+  const uint8_t * bytes = reader->_data + reader->_position;
+  reader->_position += length;
+  return (RESULT(wire_pointer, wire_error)) RESULT_SUCCESS(bytes);
+}
+
+/**
+ * Writes a tag byte, followed by a zigzag-encoded failure value if the tag is
+ * #WIRE_TAG_FAILURE.
+ *
+ * @param writer The writer.
+ * @param tag The tag byte.
+ * @param failure The failure value.
+ * @return A successful result, or a failed result holding
+ *   #WIRE_ERROR_NO_SPACE.
+ */
+static inline RESULT_VOID(wire_error) wire_write_tag(
+    struct wire_writer * writer, uint8_t tag, int64_t failure) {
+  if (writer->_length >= writer->_capacity) {
+    return (RESULT_VOID(wire_error)) RESULT_FAILURE(WIRE_ERROR_NO_SPACE);
+  }
+  writer->_data[writer->_length++] = tag;
+  if (tag == WIRE_TAG_SUCCESS) {
+    return (RESULT_VOID(wire_error)) RESULT_VOID_SUCCESS();
+  }
+  const RESULT_VOID(wire_error) written = wire_write_varint(writer,
+    ((uint64_t) failure << 1) ^ (uint64_t) (failure >> 63));
+  if (RESULT_HAS_FAILURE(written)) {
+    writer->_length--;
+  }
+  return written;
+}
+
+/**
+ * Reads a tag byte, followed by a zigzag-encoded failure value if the tag is
+ * #WIRE_TAG_FAILURE.
+ *
+ * @param reader The reader.
+ * @param failure The variable that receives the failure value.
+ * @return A successful result holding the tag byte, or a failed result holding
+ *   #WIRE_ERROR_TRUNCATED, #WIRE_ERROR_INVALID_TAG or #WIRE_ERROR_OVERFLOW.
+ */
+static inline RESULT(uint64_t, wire_error) wire_read_tag(
+    struct wire_reader * reader, int64_t * failure) {
+  if (reader->_position >= reader->_length) {
+    return (RESULT(uint64_t, wire_error)) RESULT_FAILURE(WIRE_ERROR_TRUNCATED);
+  }
+  const uint8_t tag = reader->_data[reader->_position++];
+  if (tag == WIRE_TAG_SUCCESS) {
+    return (RESULT(uint64_t, wire_error)) RESULT_SUCCESS(tag);
+  }
+  if (tag != WIRE_TAG_FAILURE) {
+    return (RESULT(uint64_t, wire_error))
+      RESULT_FAILURE(WIRE_ERROR_INVALID_TAG);
+  }
+  const RESULT(uint64_t, wire_error) code = wire_read_varint(reader);
+  if (RESULT_HAS_FAILURE(code)) {
+    return code;
+  }
+  const uint64_t zigzag = RESULT_USE_SUCCESS(code);
+  *failure = (int64_t) (zigzag >> 1) ^ -(int64_t) (zigzag & 1);
+  return (RESULT(uint64_t, wire_error)) RESULT_SUCCESS(tag);
+}
+
+/**
+ * Returns the name of the function that encodes a result type.
+ *
+ * @param success_type_name The success type name.
+ * @param failure_type_name The failure type name.
+ * @return The name of the function generated by #RESULT_WIRE_CODEC.
+ */
+#define RESULT_WIRE_ENCODER(success_type_name, failure_type_name)           \
+  result_wire_encode_ ## success_type_name ## _and_ ## failure_type_name
+
+/**
+ * Returns the name of the function that decodes a result type.
+ *
+ * @param success_type_name The success type name.
+ * @param failure_type_name The failure type name.
+ * @return The name of the function generated by #RESULT_WIRE_CODEC.
+ */
+#define RESULT_WIRE_DECODER(success_type_name, failure_type_name)           \
+  result_wire_decode_ ## success_type_name ## _and_ ## failure_type_name
+
+/**
+ * Returns the name of the function that encodes an array of results.
+ *
+ * @param success_type_name The success type name.
+ * @param failure_type_name The failure type name.
+ * @return The name of the function generated by #RESULT_WIRE_CODEC.
+ */
+#define RESULT_WIRE_BATCH_ENCODER(success_type_name, failure_type_name)     \
+  result_wire_encode_batch_ ## success_type_name ## _and_ ##                \
+    failure_type_name
+
+/**
+ * Returns the name of the function that decodes an array of results.
+ *
+ * @param success_type_name The success type name.
+ * @param failure_type_name The failure type name.
+ * @return The name of the function generated by #RESULT_WIRE_CODEC.
+ */
+#define RESULT_WIRE_BATCH_DECODER(success_type_name, failure_type_name)     \
+  result_wire_decode_batch_ ## success_type_name ## _and_ ##                \
+    failure_type_name
+
+/**
+ * Defines the functions that encode and decode a result type.
+ *
+ * The failure type MUST be an integer or enumeration type. Success values are
+ * encoded and decoded by the supplied codec functions, which have the
+ * following signatures:
+ *
+ * ```c
+ * RESULT_VOID(wire_error) encoder(struct wire_writer *, const success_type *);
+ * RESULT_VOID(wire_error) decoder(struct wire_reader *, success_type *);
+ * ```
+ *
+ * Four `static inline` functions are defined:
+ *
+ * - #RESULT_WIRE_ENCODER encodes a result.
+ * - #RESULT_WIRE_DECODER decodes a result.
+ * - #RESULT_WIRE_BATCH_ENCODER encodes a varint count followed by an array of
+ *   results.
+ * - #RESULT_WIRE_BATCH_DECODER decodes an array of results encoded that way,
+ *   and returns the count.
+ *
+ * When encoding fails, the writer is left as it was before the call; likewise,
+ * when decoding fails, the reader is left as it was before the call, and so is
+ * the decoded result. A failed batch decoding may still have overwritten the
+ * results that precede the one that failed. Encoded failure values that do not
+ * fit in the failure type are reported as #WIRE_ERROR_OVERFLOW, and so are
+ * batches with more results than the array can hold.
+ *
+ * @b Example:
+ * @snippet example.c result_wire
+ *
+ * @param success_type The success type.
+ * @param failure_type The failure type.
+ * @param success_encoder The function that writes success values.
+ * @param success_decoder The function that reads success values.
+ * @return The function definitions.
+ *
+ * @see RESULT_WIRE_FIXED_CODEC
+ */
+#define RESULT_WIRE_CODEC(success_type, failure_type, success_encoder,      \
+    success_decoder)                                                        \
+  static inline RESULT_VOID(wire_error)                                     \
+  RESULT_WIRE_ENCODER(success_type, failure_type)(                          \
+      struct wire_writer * writer,                                          \
+      const RESULT(success_type, failure_type) * result) {                  \
+    const size_t length = writer->_length;                                  \
+    RESULT_VOID(wire_error) written = RESULT_HAS_FAILURE(*result)           \
+      ? wire_write_tag(writer, WIRE_TAG_FAILURE,                            \
+        (int64_t) RESULT_USE_FAILURE(*result))                              \
+      : wire_write_tag(writer, WIRE_TAG_SUCCESS, 0);                        \
+    if (RESULT_HAS_SUCCESS(written) && RESULT_HAS_SUCCESS(*result)) {       \
+      written = success_encoder(writer, &RESULT_USE_SUCCESS(*result));      \
+    }                                                                       \
+    if (RESULT_HAS_FAILURE(written)) {                                      \
+      writer->_length = length;                                             \
+    }                                                                       \
+    return written;                                                         \
+  }                                                                         \
+  static inline RESULT_VOID(wire_error)                                     \
+  RESULT_WIRE_DECODER(success_type, failure_type)(                          \
+      struct wire_reader * reader,                                          \
+      RESULT(success_type, failure_type) * result) {                        \
+    const size_t position = reader->_position;                              \
+    int64_t code = 0;                                                       \
+    const RESULT(uint64_t, wire_error) tag = wire_read_tag(reader, &code);  \
+    if (RESULT_HAS_FAILURE(tag)) {                                          \
+      reader->_position = position;                                         \
+      return (RESULT_VOID(wire_error))                                      \
+        RESULT_FAILURE(RESULT_USE_FAILURE(tag));                            \
+    }                                                                       \
+    if (RESULT_USE_SUCCESS(tag) == WIRE_TAG_SUCCESS) {                      \
+      success_type value = {0};                                             \
+      const RESULT_VOID(wire_error) read = success_decoder(reader, &value); \
+      if (RESULT_HAS_FAILURE(read)) {                                       \
+        reader->_position = position;                                       \
+        return read;                                                        \
+      }                                                                     \
+      *result = (RESULT(success_type, failure_type)) RESULT_SUCCESS(value); \
+      return read;                                                          \
+    }                                                                       \
+    const failure_type failure = (failure_type) code;                       \
+    if ((int64_t) failure != code) {                                        \
+      reader->_position = position;                                         \
+      return (RESULT_VOID(wire_error)) RESULT_FAILURE(WIRE_ERROR_OVERFLOW); \
+    }                                                                       \
+    *result = (RESULT(success_type, failure_type)) RESULT_FAILURE(failure); \
+    return (RESULT_VOID(wire_error)) RESULT_VOID_SUCCESS();                 \
+  }                                                                         \
+  static inline RESULT_VOID(wire_error)                                     \
+  RESULT_WIRE_BATCH_ENCODER(success_type, failure_type)(                    \
+      struct wire_writer * writer,                                          \
+      const RESULT(success_type, failure_type) * results, size_t count) {   \
+    const size_t length = writer->_length;                                  \
+    RESULT_VOID(wire_error) written = wire_write_varint(writer, count);     \
+    for (size_t index = 0; index < count                                    \
+        && RESULT_HAS_SUCCESS(written); index++) {                          \
+      written = RESULT_WIRE_ENCODER(success_type, failure_type)(writer,     \
+        &results[index]);                                                   \
+    }                                                                       \
+    if (RESULT_HAS_FAILURE(written)) {                                      \
+      writer->_length = length;                                             \
+    }                                                                       \
+    return written;                                                         \
+  }                                                                         \
+  static inline RESULT(size_t, wire_error)                                  \
+  RESULT_WIRE_BATCH_DECODER(success_type, failure_type)(                    \
+      struct wire_reader * reader,                                          \
+      RESULT(success_type, failure_type) * results, size_t capacity) {      \
+    const size_t position = reader->_position;                              \
+    const RESULT(uint64_t, wire_error) count = wire_read_varint(reader);    \
+    if (RESULT_HAS_FAILURE(count)) {                                        \
+      reader->_position = position;                                         \
+      return (RESULT(size_t, wire_error))                                   \
+        RESULT_FAILURE(RESULT_USE_FAILURE(count));                          \
+    }                                                                       \
+    if (RESULT_USE_SUCCESS(count) > capacity) {                             \
+      reader->_position = position;                                         \
+      return (RESULT(size_t, wire_error))                                   \
+        RESULT_FAILURE(WIRE_ERROR_OVERFLOW);                                \
+    }                                                                       \
+    const size_t total = (size_t) RESULT_USE_SUCCESS(count);                \
+    for (size_t index = 0; index < total; index++) {                        \
+      const RESULT_VOID(wire_error) read =                                  \
+        RESULT_WIRE_DECODER(success_type, failure_type)(reader,             \
+          &results[index]);                                                 \
+      if (RESULT_HAS_FAILURE(read)) {                                       \
+        reader->_position = position;                                       \
+        return (RESULT(size_t, wire_error))                                 \
+          RESULT_FAILURE(RESULT_USE_FAILURE(read));                         \
+      }                                                                     \
+    }                                                                       \
+    return (RESULT(size_t, wire_error)) RESULT_SUCCESS(total);              \
+  }                                                                         \
+  _Static_assert(sizeof(failure_type) <= sizeof(int64_t),                   \
+    "The failure type MUST fit in 64 bits")
+
+/**
+ * Defines the functions that encode and decode a result type whose success
+ * values are copied verbatim.
+ *
+ * Success values are written as their in-memory representation, with their
+ * padding bytes set to zero so that no uninitialized memory is sent. On
+ * compilers without `__builtin_clear_padding`, padding bytes are sent as they
+ * are (see #RESULT_CLEARS_PADDING). When decoding, the bytes are copied from the buffer of the reader into the
+ * result. This suits payloads of a fixed size that contain no pointers,
+ * exchanged between processes on the same host. Payloads that should not be
+ * copied can be read in place via #wire_read_bytes instead.
+ *
+ * @b Example:
+ * @snippet example.c result_wire_codec
+ *
+ * @param success_type The success type.
+ * @param failure_type The failure type.
+ * @return The function definitions.
+ *
+ * @see RESULT_WIRE_CODEC
+ */
+#define RESULT_WIRE_FIXED_CODEC(success_type, failure_type)                 \
+  static inline RESULT_VOID(wire_error)                                     \
+  result_wire_write_ ## success_type ## _and_ ## failure_type(              \
+      struct wire_writer * writer, const success_type * value) {            \
+    success_type bytes;                                                     \
+    memcpy(&bytes, value, sizeof(success_type));                            \
+    RESULT_CLEAR_PADDING(&bytes);                                           \
+    return wire_write_bytes(writer, &bytes, sizeof(success_type));          \
+  }                                                                         \
+  static inline RESULT_VOID(wire_error)                                     \
+  result_wire_read_ ## success_type ## _and_ ## failure_type(               \
+      struct wire_reader * reader, success_type * value) {                  \
+    const RESULT(wire_pointer, wire_error) bytes =                          \
+      wire_read_bytes(reader, sizeof(success_type));                        \
+    if (RESULT_HAS_FAILURE(bytes)) {                                        \
+      return (RESULT_VOID(wire_error))                                      \
+        RESULT_FAILURE(RESULT_USE_FAILURE(bytes));                          \
+    }                                                                       \
+    memcpy(value, RESULT_USE_SUCCESS(bytes), sizeof(success_type));         \
+    return (RESULT_VOID(wire_error)) RESULT_VOID_SUCCESS();                 \
+  }                                                                         \
+  RESULT_WIRE_CODEC(success_type, failure_type,                             \
+    result_wire_write_ ## success_type ## _and_ ## failure_type,            \
+    result_wire_read_ ## success_type ## _and_ ## failure_type)
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+OPTION_STRUCT(int);
+
+#define is_even(x) \
+    ((x) % 2 == 0)
+
+/**
+ * Tests `OPTION_FILTER`.
+ */
+int main() {
+    // Given
+    const OPTION(int) even = OPTION_SOME(512);
+    const OPTION(int) odd = OPTION_SOME(513);
+    const OPTION(int) none = OPTION_NONE();
+    // When
+    const OPTION(int) filtered_even = OPTION_FILTER(even, is_even);
+    const OPTION(int) filtered_odd = OPTION_FILTER(odd, is_even);
+    const OPTION(int) filtered_none = OPTION_FILTER(none, is_even);
+    // Then
+    TEST_ASSERT(OPTION_HAS_VALUE(filtered_even));
+    TEST_ASSERT_INT_EQUALS(OPTION_USE_VALUE(filtered_even), 512);
+    TEST_ASSERT(OPTION_IS_EMPTY(filtered_odd));
+    TEST_ASSERT(OPTION_IS_EMPTY(filtered_none));
+    TEST_PASS;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+OPTION_STRUCT(int);
+
+OPTION_STRUCT_POINTER(text);
+
+static OPTION(int) parse_digit(const char *s) {
+    if (*s >= '0' && *s <= '9') {
+        return (OPTION(int)) OPTION_SOME(*s - '0');
+    }
+    return (OPTION(int)) OPTION_NONE();
+}
+
+/**
+ * Tests `OPTION_FLAT_MAP`.
+ */
+int main() {
+    // Given
+    const OPTION(text) digit = OPTION_SOME_POINTER("7");
+    const OPTION(text) letter = OPTION_SOME_POINTER("X");
+    const OPTION(text) none = OPTION_NONE();
+    // When
+    const OPTION(int) mapped_digit = OPTION_FLAT_MAP(digit, parse_digit);
+    const OPTION(int) mapped_letter = OPTION_FLAT_MAP(letter, parse_digit);
+    const OPTION(int) mapped_none = OPTION_FLAT_MAP(none, parse_digit);
+    // Then
+    TEST_ASSERT(OPTION_HAS_VALUE(mapped_digit));
+    TEST_ASSERT_INT_EQUALS(OPTION_USE_VALUE(mapped_digit), 7);
+    TEST_ASSERT(OPTION_IS_EMPTY(mapped_letter));
+    TEST_ASSERT(OPTION_IS_EMPTY(mapped_none));
+    TEST_PASS;
+}
@@ -0,0 +1,41 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+RESULT_STRUCT(text, char);
+
+OPTION_STRUCT_POINTER(text);
+
+/**
+ * Tests `OPTION_FROM_RESULT`.
+ */
+int main() {
+    // Given
+    const RESULT(text, char) success = RESULT_SUCCESS("Success");
+    const RESULT(text, char) failure = RESULT_FAILURE('F');
+    // When
+    const OPTION(text) some = OPTION_FROM_RESULT(success, OPTION(text));
+    const OPTION(text) none = OPTION_FROM_RESULT(failure, OPTION(text));
+    // Then
+    TEST_ASSERT(OPTION_HAS_VALUE(some));
+    TEST_ASSERT_STR_EQUALS(OPTION_USE_VALUE(some), "Success");
+    TEST_ASSERT(OPTION_IS_EMPTY(none));
+    TEST_PASS;
+}
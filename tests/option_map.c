@@ -0,0 +1,44 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+OPTION_STRUCT(char);
+
+OPTION_STRUCT_POINTER(text);
+
+#define first_char(s) \
+    *s
+
+/**
+ * Tests `OPTION_MAP`.
+ */
+int main() {
+    // Given
+    const OPTION(text) some = OPTION_SOME_POINTER("Value");
+    const OPTION(text) none = OPTION_NONE();
+    // When
+    const OPTION(char) mapped_some = OPTION_MAP(some, first_char, OPTION(char));
+    const OPTION(char) mapped_none = OPTION_MAP(none, first_char, OPTION(char));
+    // Then
+    TEST_ASSERT(OPTION_HAS_VALUE(mapped_some));
+    TEST_ASSERT_CHAR_EQUALS(OPTION_USE_VALUE(mapped_some), 'V');
+    TEST_ASSERT(OPTION_IS_EMPTY(mapped_none));
+    TEST_PASS;
+}
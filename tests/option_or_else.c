@@ -0,0 +1,46 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+OPTION_STRUCT(int);
+
+OPTION_STRUCT_POINTER(text);
+
+/**
+ * Tests `OPTION_OR_ELSE`.
+ */
+int main() {
+    // Given
+    const OPTION(int) some = OPTION_SOME(512);
+    const OPTION(int) none = OPTION_NONE();
+    const OPTION(text) pointer_some = OPTION_SOME_POINTER("Value");
+    const OPTION(text) pointer_none = OPTION_NONE();
+    // When
+    const int some_or_else = OPTION_OR_ELSE(some, -1);
+    const int none_or_else = OPTION_OR_ELSE(none, -1);
+    const text pointer_some_or_else = OPTION_OR_ELSE(pointer_some, "Other");
+    const text pointer_none_or_else = OPTION_OR_ELSE(pointer_none, "Other");
+    // Then
+    TEST_ASSERT_INT_EQUALS(some_or_else, 512);
+    TEST_ASSERT_INT_EQUALS(none_or_else, -1);
+    TEST_ASSERT_STR_EQUALS(pointer_some_or_else, "Value");
+    TEST_ASSERT_STR_EQUALS(pointer_none_or_else, "Other");
+    TEST_PASS;
+}
@@ -0,0 +1,33 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+OPTION_STRUCT(int);
+
+/**
+ * Tests `OPTION_SOME`.
+ */
+int main() {
+    // Given
+    const OPTION(int) option = OPTION_SOME(512);
+    // Then
+    TEST_ASSERT(OPTION_HAS_VALUE(option));
+    TEST_ASSERT_FALSE(OPTION_IS_EMPTY(option));
+    TEST_ASSERT_INT_EQUALS(OPTION_USE_VALUE(option), 512);
+    TEST_PASS;
+}
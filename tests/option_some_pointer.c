@@ -0,0 +1,36 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+OPTION_STRUCT_POINTER(text);
+
+/**
+ * Tests `OPTION_SOME_POINTER`.
+ */
+int main() {
+    // Given
+    const OPTION(text) option = OPTION_SOME_POINTER("Value");
+    // Then
+    TEST_ASSERT(OPTION_HAS_VALUE(option));
+    TEST_ASSERT_FALSE(OPTION_IS_EMPTY(option));
+    TEST_ASSERT_STR_EQUALS(OPTION_USE_VALUE(option), "Value");
+    TEST_ASSERT(sizeof(option) == sizeof(text));
+    TEST_PASS;
+}
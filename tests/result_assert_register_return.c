@@ -0,0 +1,43 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+RESULT_STRUCT(int, char);
+
+RESULT_ASSERT_REGISTER_RETURN(RESULT(int, char));
+
+static RESULT(int, char) parse(int value) {
+    RESULT(int, char) result = RESULT_SUCCESS(value);
+    return result;
+}
+
+/**
+ * Tests `RESULT_ASSERT_REGISTER_RETURN`.
+ */
+int main() {
+    // Given
+    const int value = 123;
+    // When
+    const RESULT(int, char) result = parse(value);
+    // Then
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(result), 123);
+#ifdef NDEBUG
+    TEST_ASSERT(sizeof(result) <= RESULT_REGISTER_RETURN_SIZE);
+#endif
+    TEST_PASS;
+}
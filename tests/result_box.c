@@ -0,0 +1,41 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+/**
+ * Tests `RESULT_BOX` and `RESULT_ARENA_RESET`.
+ */
+int main() {
+    // Given
+    RESULT_ARENA(2 * sizeof(double)) arena = {0};
+    // When
+    const char *first = RESULT_BOX(arena, (char) 'x');
+    const double *second = RESULT_BOX(arena, 1.5);
+    const double *exhausted = RESULT_BOX(arena, 2.5);
+    RESULT_ARENA_RESET(arena);
+    const double *reused = RESULT_BOX(arena, 3.5);
+    // Then
+    TEST_ASSERT_NOT_NULL(first);
+    TEST_ASSERT_NOT_NULL(second);
+    TEST_ASSERT_NULL(exhausted);
+    TEST_ASSERT_NOT_NULL(reused);
+    TEST_ASSERT((void *) second == (void *) &arena._bytes[sizeof(double)]);
+    TEST_ASSERT((void *) reused == (void *) first);
+    TEST_ASSERT(*reused == 3.5);
+    TEST_PASS;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef struct { int code; char details[200]; } large_error;
+
+RESULT_STRUCT_BOXED(int, large_error);
+
+static RESULT_ARENA(256) arena;
+
+static const large_error fallback = {.code = -1, .details = "Fallback"};
+
+/**
+ * Tests `RESULT_BOX_FAILURE`.
+ */
+int main() {
+    // Given
+    large_error error = {.code = 42, .details = "Details"};
+    // When
+    const RESULT_BOXED(int, large_error) result = RESULT_BOX_FAILURE(arena, error, &fallback);
+    const RESULT_BOXED(int, large_error) exhausted = RESULT_BOX_FAILURE(arena, error, &fallback);
+    // Then
+    TEST_ASSERT(sizeof(result) < sizeof(large_error));
+    TEST_ASSERT(RESULT_HAS_FAILURE(result));
+    TEST_ASSERT_NOT_NULL(RESULT_USE_FAILURE(result));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(result)->code, 42);
+    TEST_ASSERT_STR_EQUALS(RESULT_USE_FAILURE(result)->details, "Details");
+    TEST_ASSERT(RESULT_USE_FAILURE(exhausted) == &fallback);
+    TEST_PASS;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define RESULT_COPY_SITES 2
+#include <stdlib.h>
+#include <string.h>
+#include <result_copy.h>
+#include "test.h"
+
+typedef struct {
+    char bytes[100];
+} large;
+
+typedef const char *text;
+
+RESULT_STRUCT(large, text);
+
+RESULT_STRUCT(int, text);
+
+#define first_byte(value) \
+    value.bytes[0]
+
+#define ignore(value) \
+    (void) value
+
+/**
+ * Tests copy-count mode.
+ */
+int main() {
+    // Given
+    const large value = {"Large"};
+    const RESULT(large, text) result = RESULT_SUCCESS(value);
+    struct result_copy_site sites[3] = {0};
+    char *report = NULL;
+    size_t length = 0;
+    FILE *stream = open_memstream(&report, &length);
+    // When
+    for (int index = 0; index < 3; index++) {
+        const RESULT(int, text) mapped = RESULT_MAP_SUCCESS(result, first_byte, RESULT(int, text));
+        TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(mapped), 'L');
+    }
+    RESULT_IF_SUCCESS(result, ignore); RESULT_IF_SUCCESS(result, ignore);
+    RESULT_IF_FAILURE(result, ignore);
+    const size_t count = result_copy_rank(sites, 3);
+    result_copy_report(stream, 10);
+    (void) fclose(stream);
+    // Then
+    TEST_ASSERT_INT_EQUALS((int) count, 2);
+    TEST_ASSERT_NOT_NULL(strstr(sites[0].site, "result_copy_count.c:"));
+    TEST_ASSERT_INT_EQUALS((int) sites[0].copies, 1);
+    TEST_ASSERT_INT_EQUALS((int) sites[0].bytes, (int) sizeof(result));
+    TEST_ASSERT_INT_EQUALS((int) sites[1].copies, 3);
+    TEST_ASSERT_INT_EQUALS((int) sites[1].bytes, 3 * (int) sizeof(RESULT(int, text)));
+    TEST_ASSERT_NULL(sites[2].site);
+    TEST_ASSERT(result_copy_untracked() == 2);
+    TEST_ASSERT_STR_CONTAINS(report, sites[0].site);
+    TEST_ASSERT_STR_CONTAINS(report, sites[1].site);
+    TEST_ASSERT_STR_CONTAINS(report, "untracked call sites: 2");
+    free(report);
+    TEST_PASS;
+}
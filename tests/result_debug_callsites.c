@@ -0,0 +1,69 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define RESULT_DEBUG_CALLSITES
+#include <string.h>
+#include <result_log.h>
+#include "test.h"
+
+RESULT_STRUCT(int, char);
+
+RESULT_STRUCT_PACKED64(short, char);
+
+/**
+ * Tests callsite records.
+ */
+int main() {
+#ifdef NDEBUG
+    TEST_SKIP("Callsite records are only available in debug builds");
+#else
+    // Given
+    const RESULT(int, char) success = RESULT_SUCCESS(123);
+    const RESULT(int, char) failure = RESULT_FAILURE('x');
+    const RESULT(int, char) constant = RESULT_STATIC_SUCCESS(456);
+    const RESULT(int, char) zeroed = {0};
+    RESULT(short, char) packed = RESULT_SUCCESS(789);
+    const RESULT(short, char) loaded = RESULT_PACKED64_LOAD(&packed);
+    int records = 0;
+    // When
+    for (const struct result_callsite * callsite = result_callsites_begin();
+            callsite != result_callsites_end(); callsite++) {
+        if (strstr(RESULT_CALLSITE_FILE(callsite), "result_debug_callsites.c") != NULL) {
+            TEST_ASSERT_STR_EQUALS(RESULT_CALLSITE_FUNC(callsite), "main");
+            records++;
+        }
+    }
+    // Then
+    TEST_ASSERT_INT_EQUALS(records, 3);
+    TEST_ASSERT_INT_EQUALS((int) sizeof(success._debug), (int) sizeof(void *));
+    TEST_ASSERT_STR_EQUALS(RESULT_DEBUG_FUNC(success), "main");
+    TEST_ASSERT_STR_CONTAINS(RESULT_DEBUG_FILE(failure), "result_debug_callsites.c");
+    TEST_ASSERT_INT_EQUALS(RESULT_DEBUG_LINE(success), 34);
+    TEST_ASSERT_INT_EQUALS(RESULT_DEBUG_LINE(failure), 35);
+    TEST_ASSERT_NULL(RESULT_DEBUG_FUNC(constant));
+    TEST_ASSERT_NULL(RESULT_DEBUG_FILE(constant));
+    TEST_ASSERT_INT_EQUALS(RESULT_DEBUG_LINE(constant), 36);
+    TEST_ASSERT_NULL(RESULT_DEBUG_FUNC(zeroed));
+    TEST_ASSERT_NULL(RESULT_DEBUG_FILE(zeroed));
+    TEST_ASSERT_INT_EQUALS(RESULT_DEBUG_LINE(zeroed), 0);
+    TEST_ASSERT_NULL(RESULT_DEBUG_FILE(loaded));
+    TEST_ASSERT_INT_EQUALS(RESULT_DEBUG_LINE(loaded), 0);
+    TEST_ASSERT(RESULT_LOG_CALLSITE(success) < UINT32_MAX);
+    TEST_ASSERT(RESULT_LOG_CALLSITE(constant) == UINT32_MAX);
+    TEST_ASSERT(RESULT_LOG_CALLSITE(zeroed) == UINT32_MAX);
+    TEST_PASS;
+#endif
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+RESULT_STRUCT(int, text);
+
+/**
+ * Tests `RESULT_EMPLACE_FAILURE`.
+ */
+int main() {
+    // Given
+    RESULT(int, text) result;
+    // When
+    RESULT_EMPLACE_FAILURE(&result, "Failure");
+    // Then
+    TEST_ASSERT(RESULT_HAS_FAILURE(result));
+    TEST_ASSERT_STR_EQUALS(RESULT_USE_FAILURE(result), "Failure");
+    TEST_PASS;
+}
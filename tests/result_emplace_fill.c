@@ -0,0 +1,50 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+RESULT_STRUCT(int, text);
+
+static void emplace_square_or_fail(RESULT(int, text) *slot, size_t index) {
+    if (index % 2 == 0) {
+        RESULT_EMPLACE_SUCCESS(slot, (int) (index * index));
+    } else {
+        RESULT_EMPLACE_FAILURE(slot, "Odd");
+    }
+}
+
+/**
+ * Tests `RESULT_EMPLACE_FILL`.
+ */
+int main() {
+    // Given
+    RESULT(int, text) results[4];
+    // When
+    RESULT_EMPLACE_FILL(results, 4, emplace_square_or_fail);
+    // Then
+    TEST_ASSERT(RESULT_HAS_SUCCESS(results[0]));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(results[0]), 0);
+    TEST_ASSERT(RESULT_HAS_FAILURE(results[1]));
+    TEST_ASSERT_STR_EQUALS(RESULT_USE_FAILURE(results[1]), "Odd");
+    TEST_ASSERT(RESULT_HAS_SUCCESS(results[2]));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(results[2]), 4);
+    TEST_ASSERT(RESULT_HAS_FAILURE(results[3]));
+    TEST_ASSERT_STR_EQUALS(RESULT_USE_FAILURE(results[3]), "Odd");
+    TEST_PASS;
+}
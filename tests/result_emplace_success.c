@@ -0,0 +1,44 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef struct {
+    int x;
+    int y;
+} point;
+
+typedef const char *text;
+
+RESULT_STRUCT(point, text);
+
+/**
+ * Tests `RESULT_EMPLACE_SUCCESS`.
+ */
+int main() {
+    // Given
+    RESULT(point, text) results[2];
+    int index = 0;
+    // When
+    RESULT_EMPLACE_SUCCESS(&results[++index], (point) {123, 456});
+    // Then
+    TEST_ASSERT_INT_EQUALS(index, 1);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(results[1]));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(results[1]).x, 123);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(results[1]).y, 456);
+    TEST_PASS;
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result_message.h>
+#include "test.h"
+
+RESULT_STRUCT_TAG(int, struct result_message, RESULT_TAG(int, message));
+
+/**
+ * Tests `RESULT_FAILURE_FMT`.
+ */
+int main() {
+    // Given
+    const char *name = "Rex";
+    const RESULT(int, message) none = RESULT_FAILURE_FMT("No arguments: 100%%");
+    const RESULT(int, message) some = RESULT_FAILURE_FMT("Pet %s (%d) costs %.2f", name, 42, 9.5);
+    const RESULT(int, message) all = RESULT_FAILURE_FMT("%c%5u|%-3ld|%x", 'x', 7u, -1L, 255u);
+    const RESULT(int, message) missing = RESULT_FAILURE_FMT("Missing %d and %d", 1);
+    char buffer[64];
+    // Then
+    TEST_ASSERT(RESULT_HAS_FAILURE(some));
+    TEST_ASSERT_STR_EQUALS(RESULT_FAILURE_MESSAGE(none, buffer, sizeof(buffer)), "No arguments: 100%");
+    TEST_ASSERT_STR_EQUALS(RESULT_FAILURE_MESSAGE(some, buffer, sizeof(buffer)), "Pet Rex (42) costs 9.50");
+    TEST_ASSERT_STR_EQUALS(RESULT_FAILURE_MESSAGE(all, buffer, sizeof(buffer)), "x    7|-1 |ff");
+    TEST_ASSERT_STR_EQUALS(RESULT_FAILURE_MESSAGE(missing, buffer, sizeof(buffer)), "Missing 1 and ");
+    TEST_PASS;
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result_message.h>
+#include "test.h"
+
+RESULT_STRUCT_TAG(int, struct result_message, RESULT_TAG(int, message));
+
+/**
+ * Tests `RESULT_FAILURE_MESSAGE` with a small buffer.
+ */
+int main() {
+    // Given
+    const RESULT(int, message) result = RESULT_FAILURE_FMT("Pet %d is %s", 12345, "not available");
+    char buffer[8];
+    // When
+    const char *message = RESULT_FAILURE_MESSAGE(result, buffer, sizeof(buffer));
+    // Then
+    TEST_ASSERT(message == buffer);
+    TEST_ASSERT_STR_EQUALS(message, "Pet 123");
+    TEST_PASS;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <result_string.h>
+#include "test.h"
+
+RESULT_STRUCT(int, result_string);
+
+/**
+ * Tests `RESULT_FAILURE_STR`.
+ */
+int main() {
+    // Given
+    const RESULT(int, result_string) result = RESULT_FAILURE_STR("Error %d: %s", 404, "Not found");
+    // When
+    const RESULT(int, result_string) copy = result;
+    // Then
+    TEST_ASSERT(RESULT_HAS_FAILURE(copy));
+    TEST_ASSERT_STR_EQUALS(RESULT_STRING_CHARS(RESULT_USE_FAILURE(copy)), "Error 404: Not found");
+    TEST_ASSERT(RESULT_STRING_CHARS(RESULT_USE_FAILURE(copy)) != RESULT_STRING_CHARS(RESULT_USE_FAILURE(result)));
+    TEST_PASS;
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <result_string.h>
+#include "test.h"
+
+RESULT_STRUCT(int, result_string);
+
+/**
+ * Tests `RESULT_FAILURE_STR` with a message that does not fit.
+ */
+int main() {
+    // Given
+    char long_message[RESULT_STRING_CAPACITY * 2];
+    memset(long_message, 'x', sizeof(long_message) - 1);
+    long_message[sizeof(long_message) - 1] = '\0';
+    // When
+    const RESULT(int, result_string) result = RESULT_FAILURE_STR("%s", long_message);
+    // Then
+    TEST_ASSERT(sizeof(RESULT_USE_FAILURE(result)) == RESULT_STRING_CAPACITY);
+    TEST_ASSERT_INT_EQUALS((int) strlen(RESULT_STRING_CHARS(RESULT_USE_FAILURE(result))), RESULT_STRING_CAPACITY - 1);
+    TEST_PASS;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result_io.h>
+#include "test.h"
+
+/**
+ * Tests `RESULT_FROM_ERRNO`.
+ */
+int main() {
+    // Given
+    const int success = 123;
+    int failure;
+    errno = 0;
+    failure = dup(-1);
+    // When
+    const RESULT(int, io_error) result1 = RESULT_FROM_ERRNO(success, -1, RESULT(int, io_error));
+    const RESULT(int, io_error) result2 = RESULT_FROM_ERRNO(failure, -1, RESULT(int, io_error));
+    // Then
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(result1), 123);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(result2), EBADF);
+    TEST_PASS;
+}
@@ -0,0 +1,40 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+OPTION_STRUCT(int);
+
+RESULT_STRUCT(int, char);
+
+/**
+ * Tests `RESULT_FROM_OPTION`.
+ */
+int main() {
+    // Given
+    const OPTION(int) some = OPTION_SOME(512);
+    const OPTION(int) none = OPTION_NONE();
+    // When
+    const RESULT(int, char) success = RESULT_FROM_OPTION(some, 'F', RESULT(int, char));
+    const RESULT(int, char) failure = RESULT_FROM_OPTION(none, 'F', RESULT(int, char));
+    // Then
+    TEST_ASSERT(RESULT_HAS_SUCCESS(success));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(success), 512);
+    TEST_ASSERT(RESULT_HAS_FAILURE(failure));
+    TEST_ASSERT_CHAR_EQUALS(RESULT_USE_FAILURE(failure), 'F');
+    TEST_PASS;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+RESULT_STRUCT(int, text);
+
+static const int *on_success1_value = NULL;
+static const int *on_success2_value = NULL;
+static const text *on_failure1_value = NULL;
+static const text *on_failure2_value = NULL;
+
+#define on_success1(value) \
+    on_success1_value = (value)
+
+#define on_success2(value) \
+    on_success2_value = (value)
+
+#define on_failure1(value) \
+    on_failure1_value = (value)
+
+#define on_failure2(value) \
+    on_failure2_value = (value)
+
+/**
+ * Tests `RESULT_IF_SUCCESS_OR_ELSE_REF` using macros.
+ */
+int main() {
+    // Given
+    const RESULT(int, text) success = RESULT_SUCCESS(512);
+    const RESULT(int, text) failure = RESULT_FAILURE("Failure");
+    // When
+    RESULT_IF_SUCCESS_OR_ELSE_REF(success, on_success1, on_failure1);
+    RESULT_IF_SUCCESS_OR_ELSE_REF(failure, on_success2, on_failure2);
+    // Then
+    TEST_ASSERT(on_success1_value == &RESULT_USE_SUCCESS(success));
+    TEST_ASSERT_NULL(on_success2_value);
+    TEST_ASSERT_NULL(on_failure1_value);
+    TEST_ASSERT(on_failure2_value == &RESULT_USE_FAILURE(failure));
+    TEST_PASS;
+}
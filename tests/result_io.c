@@ -0,0 +1,53 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <result_io.h>
+#include "test.h"
+
+/**
+ * Tests I/O wrappers.
+ */
+int main() {
+    // Given
+    char path[] = "/tmp/result_io_XXXXXX";
+    const int descriptor = mkstemp(path);
+    const char text[] = "Hello, world!";
+    char buffer[64] = {0};
+    TEST_ASSERT(descriptor != -1);
+    (void) unlink(path);
+    // When
+    const RESULT(ssize_t, io_error) written = io_write(descriptor, text, sizeof(text) - 1);
+    const RESULT(ssize_t, io_error) read_at = io_pread(descriptor, buffer, sizeof(buffer), 7);
+    const RESULT(io_stat, io_error) status = io_fstat(descriptor);
+    const RESULT(io_pointer, io_error) mapping = io_mmap(NULL, sizeof(text) - 1, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // Then
+    TEST_ASSERT_INT_EQUALS((int) RESULT_USE_SUCCESS(written), 13);
+    TEST_ASSERT_INT_EQUALS((int) RESULT_USE_SUCCESS(read_at), 6);
+    TEST_ASSERT_STR_EQUALS(buffer, "world!");
+    TEST_ASSERT_INT_EQUALS((int) RESULT_USE_SUCCESS(status).st_size, 13);
+    TEST_ASSERT(memcmp(RESULT_USE_SUCCESS(mapping), text, sizeof(text) - 1) == 0);
+    TEST_ASSERT(lseek(descriptor, 0, SEEK_SET) == 0);
+    memset(buffer, 0, sizeof(buffer));
+    const RESULT(ssize_t, io_error) read_all = io_read(descriptor, buffer, sizeof(buffer));
+    TEST_ASSERT_INT_EQUALS((int) RESULT_USE_SUCCESS(read_all), 13);
+    TEST_ASSERT_INT_EQUALS(errno, 0);
+    TEST_ASSERT_STR_EQUALS(buffer, text);
+    (void) munmap(RESULT_USE_SUCCESS(mapping), sizeof(text) - 1);
+    (void) close(descriptor);
+    TEST_PASS;
+}
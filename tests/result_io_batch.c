@@ -0,0 +1,74 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <result_uring.h>
+#include "test.h"
+
+#define OPERATIONS 600
+
+/**
+ * Tests `io_batch_submit` with the supplied mode.
+ */
+static int test_io_batch(enum io_batch_mode mode) {
+    // Given
+    char path[] = "/tmp/result_io_batch_XXXXXX";
+    const int descriptor = mkstemp(path);
+    static char buffers[OPERATIONS][4];
+    char tail[8];
+    struct io_batch batch;
+    TEST_ASSERT(descriptor != -1);
+    (void) unlink(path);
+    for (int index = 0; index < OPERATIONS; index++) {
+        char text[5];
+        (void) snprintf(text, sizeof(text), "%04d", index);
+        TEST_ASSERT_INT_EQUALS((int) RESULT_USE_SUCCESS(io_write(descriptor, text, 4)), 4);
+    }
+    TEST_ASSERT(RESULT_HAS_SUCCESS(io_batch_init(&batch, OPERATIONS + 2, mode)));
+    TEST_ASSERT(mode == IO_BATCH_AUTO || !io_batch_uses_uring(&batch));
+    for (int index = 0; index < OPERATIONS; index++) {
+        const int operation = OPERATIONS - 1 - index;
+        TEST_ASSERT(io_batch_pread(&batch, descriptor, buffers[index], 4, operation * 4));
+    }
+    TEST_ASSERT(io_batch_pread(&batch, -1, buffers[0], 4, 0));
+    TEST_ASSERT(io_batch_pread(&batch, descriptor, tail, sizeof(tail), (OPERATIONS - 1) * 4));
+    TEST_ASSERT_FALSE(io_batch_pread(&batch, descriptor, buffers[0], 4, 0));
+    // When
+    const RESULT(ssize_t, io_error) submitted = io_batch_submit(&batch);
+    // Then
+    TEST_ASSERT_INT_EQUALS((int) RESULT_USE_SUCCESS(submitted), OPERATIONS + 2);
+    for (int index = 0; index < OPERATIONS; index++) {
+        char expected[5];
+        (void) snprintf(expected, sizeof(expected), "%04d", OPERATIONS - 1 - index);
+        TEST_ASSERT_INT_EQUALS((int) RESULT_USE_SUCCESS(io_batch_result(&batch, index)), 4);
+        TEST_ASSERT(memcmp(buffers[index], expected, 4) == 0);
+    }
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(io_batch_result(&batch, OPERATIONS)), EBADF);
+    TEST_ASSERT_INT_EQUALS((int) RESULT_USE_SUCCESS(io_batch_result(&batch, OPERATIONS + 1)), 4);
+    TEST_ASSERT(memcmp(tail, buffers[0], 4) == 0);
+    io_batch_destroy(&batch);
+    (void) close(descriptor);
+    return TEST_RESULT_PASS;
+}
+
+/**
+ * Tests `io_batch_submit` using `io_uring` if available, and a thread pool.
+ */
+int main() {
+    TEST_ASSERT_INT_EQUALS(test_io_batch(IO_BATCH_AUTO), TEST_RESULT_PASS);
+    TEST_ASSERT_INT_EQUALS(test_io_batch(IO_BATCH_THREADS), TEST_RESULT_PASS);
+    TEST_PASS;
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result_io.h>
+#include "test.h"
+
+/**
+ * Tests I/O wrappers when the system calls fail.
+ */
+int main() {
+    // Given
+    char buffer[8];
+    const int descriptor = -1;
+    // When
+    const RESULT(int, io_error) opened = io_open("/nonexistent/result_io", O_RDONLY, 0);
+    const RESULT(ssize_t, io_error) read = io_read(descriptor, buffer, sizeof(buffer));
+    const RESULT(ssize_t, io_error) read_at = io_pread(descriptor, buffer, sizeof(buffer), 0);
+    const RESULT(ssize_t, io_error) written = io_write(descriptor, buffer, sizeof(buffer));
+    const RESULT(io_stat, io_error) status = io_fstat(descriptor);
+    const RESULT(io_pointer, io_error) mapping = io_mmap(NULL, 8, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    // Then
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(opened), ENOENT);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(read), EBADF);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(read_at), EBADF);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(written), EBADF);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(status), EBADF);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(mapping), EBADF);
+    TEST_PASS;
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define RESULT_LAYOUT_REGISTRY
+#define RESULT_MAX_SIZE 32
+#include <stdlib.h>
+#include <result.h>
+#include "test.h"
+
+typedef RESULT_STRUCT(int, char) int_result;
+
+RESULT_STRUCT(char, char);
+
+RESULT_STRUCT_VOID(char);
+
+RESULT_STRUCT_NAN(char);
+
+RESULT_LAYOUT_REGISTER(int_result);
+
+RESULT_LAYOUT_REGISTER(RESULT(char, char));
+
+RESULT_LAYOUT_REGISTER(RESULT(char, char));
+
+RESULT_LAYOUT_REGISTER(RESULT_VOID(char));
+
+RESULT_LAYOUT_REGISTER_NAN(RESULT_NAN(char));
+
+/**
+ * Tests `result_layout_report`.
+ */
+int main() {
+    // Given
+    const size_t max_size = SIZE_MAX;
+    char *report = NULL;
+    size_t length = 0;
+    FILE *stream = open_memstream(&report, &length);
+    // When
+    const size_t oversized = result_layout_report(stream, 0);
+    const size_t padded = result_layout_report(stdout, max_size);
+    (void) fclose(stream);
+    // Then
+    TEST_ASSERT(oversized == 4);
+    TEST_ASSERT_STR_CONTAINS(report, "struct result_nan_of_char: size 8, align 8, value @0, debug -, padding 0");
+#ifdef NDEBUG
+    TEST_ASSERT_STR_CONTAINS(report, "int_result: size 8, align 4, value @4, debug -, padding 3");
+#else
+    TEST_ASSERT_STR_CONTAINS(report, "int_result: size 32, align 8, value @4, debug @8, padding 7");
+#endif
+    free(report);
+#ifdef NDEBUG
+    TEST_ASSERT(padded == 1);
+#else
+    TEST_ASSERT(padded == 3);
+#endif
+    TEST_PASS;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdlib.h>
+#include <result_log.h>
+#include <result_mmap.h>
+#include "test.h"
+
+RESULT_STRUCT(double, int);
+
+/**
+ * Tests `result_log_append` and `RESULT_LOG_FAILURE`.
+ */
+int main() {
+    // Given
+    char path[] = "/tmp/result_log_XXXXXX";
+    const int descriptor = mkstemp(path);
+    struct result_log log;
+    struct mmap_reader reader;
+    RESULT(double, int) success = RESULT_SUCCESS(1.5);
+    RESULT(double, int) failure = RESULT_FAILURE(-5);
+    char *text = NULL;
+    size_t length = 0;
+    FILE *stream = open_memstream(&text, &length);
+    TEST_ASSERT(descriptor != -1);
+    (void) close(descriptor);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(result_log_open(&log, path, 8)));
+    // When
+    result_log_append(&log, 7, 42);
+    RESULT_LOG_FAILURE(&log, success);
+    RESULT_LOG_FAILURE(&log, failure);
+    result_log_close(&log);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(result_log_open(&log, path, 8)));
+    result_log_append(&log, 9, 1);
+    result_log_close(&log);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(mmap_reader_open(&reader, path)));
+    (void) unlink(path);
+    const RESULT(slice, io_error) contents = mmap_reader_slice(&reader, 0, mmap_reader_size(&reader));
+    const RESULT(size_t, io_error) decoded = result_log_decode(stream, SLICE_DATA(RESULT_USE_SUCCESS(contents)), mmap_reader_size(&reader));
+    (void) fclose(stream);
+    mmap_reader_close(&reader);
+    // Then
+    TEST_ASSERT(RESULT_USE_SUCCESS(decoded) == 3);
+    TEST_ASSERT_STR_CONTAINS(text, "#1 ");
+    TEST_ASSERT_STR_CONTAINS(text, " callsite=7 failure=42\n");
+    TEST_ASSERT_STR_CONTAINS(text, "#2 ");
+    TEST_ASSERT_STR_CONTAINS(text, " failure=-5\n");
+    TEST_ASSERT_STR_CONTAINS(text, "#3 ");
+    TEST_ASSERT_STR_CONTAINS(text, " callsite=9 failure=1\n");
+    TEST_ASSERT_STR_CONTAINS(text, " thread=");
+    free(text);
+    TEST_PASS;
+}
@@ -0,0 +1,48 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdlib.h>
+#include <result_log.h>
+#include "test.h"
+
+/**
+ * Tests that invalid logs are rejected.
+ */
+int main() {
+    // Given
+    char path[] = "/tmp/result_log_XXXXXX";
+    const int descriptor = mkstemp(path);
+    const char garbage[128] = "not a log";
+    struct result_log log;
+    TEST_ASSERT(descriptor != -1);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(io_write(descriptor, garbage, sizeof(garbage))));
+    (void) close(descriptor);
+    // When
+    const RESULT_VOID(io_error) capacity = result_log_open(&log, path, 6);
+    const RESULT_VOID(io_error) oversized = result_log_open(&log, path, (SIZE_MAX >> 1) + 1);
+    const RESULT_VOID(io_error) format = result_log_open(&log, path, 8);
+    const RESULT_VOID(io_error) missing = result_log_open(&log, "/nonexistent/result_log", 8);
+    const RESULT(size_t, io_error) decoded = result_log_decode(stdout, garbage, sizeof(garbage));
+    const RESULT(size_t, io_error) truncated = result_log_decode(stdout, garbage, 16);
+    (void) unlink(path);
+    // Then
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(capacity), EINVAL);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(oversized), EINVAL);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(format), EINVAL);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(missing), ENOENT);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(decoded), EINVAL);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(truncated), EINVAL);
+    TEST_PASS;
+}
@@ -0,0 +1,46 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <result_log.h>
+#include "test.h"
+
+/**
+ * Tests that logs whose header was never written are initialized again.
+ */
+int main() {
+    // Given
+    char path[] = "/tmp/result_log_XXXXXX";
+    const int descriptor = mkstemp(path);
+    const size_t size = sizeof(struct result_log_header) + 8 * sizeof(struct result_log_record);
+    struct result_log log;
+    struct stat status;
+    TEST_ASSERT(descriptor != -1);
+    TEST_ASSERT(ftruncate(descriptor, sizeof(struct result_log_header) + 4 * sizeof(struct result_log_record)) == 0);
+    (void) close(descriptor);
+    // When
+    const RESULT_VOID(io_error) opened = result_log_open(&log, path, 8);
+    // Then
+    TEST_ASSERT_TRUE(RESULT_HAS_SUCCESS(opened));
+    result_log_append(&log, 1, 2);
+    result_log_close(&log);
+    TEST_ASSERT_TRUE(RESULT_HAS_SUCCESS(result_log_open(&log, path, 16)));
+    result_log_close(&log);
+    TEST_ASSERT(stat(path, &status) == 0);
+    TEST_ASSERT((size_t) status.st_size == size);
+    (void) unlink(path);
+    TEST_PASS;
+}
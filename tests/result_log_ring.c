@@ -0,0 +1,70 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <pthread.h>
+#include <stdlib.h>
+#include <result_log.h>
+#include <result_mmap.h>
+#include "test.h"
+
+#define THREADS 4
+#define APPENDS 1000
+
+static struct result_log log;
+
+static void *append(void *argument) {
+    for (int index = 0; index < APPENDS; index++) {
+        result_log_append(&log, (uint32_t) (uintptr_t) argument, index);
+    }
+    return NULL;
+}
+
+/**
+ * Tests that concurrent appends wrap around the ring of a log.
+ */
+int main() {
+    // Given
+    char path[] = "/tmp/result_log_XXXXXX";
+    const int descriptor = mkstemp(path);
+    struct mmap_reader reader;
+    pthread_t threads[THREADS];
+    char *text = NULL;
+    size_t length = 0;
+    FILE *stream = open_memstream(&text, &length);
+    TEST_ASSERT(descriptor != -1);
+    (void) close(descriptor);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(result_log_open(&log, path, 64)));
+    // When
+    for (uintptr_t index = 0; index < THREADS; index++) {
+        TEST_ASSERT(pthread_create(&threads[index], NULL, append, (void *) index) == 0);
+    }
+    for (int index = 0; index < THREADS; index++) {
+        TEST_ASSERT(pthread_join(threads[index], NULL) == 0);
+    }
+    result_log_close(&log);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(mmap_reader_open(&reader, path)));
+    (void) unlink(path);
+    const RESULT(slice, io_error) contents = mmap_reader_slice(&reader, 0, mmap_reader_size(&reader));
+    const RESULT(size_t, io_error) decoded = result_log_decode(stream, SLICE_DATA(RESULT_USE_SUCCESS(contents)), mmap_reader_size(&reader));
+    (void) fclose(stream);
+    mmap_reader_close(&reader);
+    // Then
+    TEST_ASSERT(RESULT_USE_SUCCESS(decoded) == 64);
+    TEST_ASSERT_STR_CONTAINS(text, "#3937 ");
+    TEST_ASSERT_STR_CONTAINS(text, "#4000 ");
+    TEST_ASSERT(strstr(text, "#3936 ") == NULL);
+    free(text);
+    TEST_PASS;
+}
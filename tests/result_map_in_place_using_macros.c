@@ -0,0 +1,58 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef struct {
+    int x;
+    int y;
+} point;
+
+typedef struct {
+    const char *text;
+    int code;
+} error;
+
+RESULT_STRUCT(point, error);
+
+#define point_move(p) \
+    ((p)->x++, (p)->y--)
+
+#define error_retry(e) \
+    ((e)->code = 503)
+
+/**
+ * Tests `RESULT_MAP_IN_PLACE` using macros.
+ */
+int main() {
+    // Given
+    const point p = {123, 456};
+    const error e = {"Failure", 500};
+    RESULT(point, error) success = RESULT_SUCCESS(p);
+    RESULT(point, error) failure = RESULT_FAILURE(e);
+    // When
+    RESULT_MAP_IN_PLACE(success, point_move, error_retry);
+    RESULT_MAP_IN_PLACE(failure, point_move, error_retry);
+    // Then
+    TEST_ASSERT(RESULT_HAS_SUCCESS(success));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(success).x, 124);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(success).y, 455);
+    TEST_ASSERT(RESULT_HAS_FAILURE(failure));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(failure).code, 503);
+    TEST_ASSERT_STR_EQUALS(RESULT_USE_FAILURE(failure).text, "Failure");
+    TEST_PASS;
+}
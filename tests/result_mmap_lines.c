@@ -0,0 +1,52 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <result_mmap.h>
+#include <result_strview.h>
+#include "test.h"
+
+/**
+ * Tests `mmap_reader_next_line`.
+ */
+int main() {
+    // Given
+    char path[] = "/tmp/result_mmap_XXXXXX";
+    const int descriptor = mkstemp(path);
+    const char text[] = "Rex\n\nGarfield";
+    struct mmap_reader reader;
+    TEST_ASSERT(descriptor != -1);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(io_write(descriptor, text, sizeof(text) - 1)));
+    (void) close(descriptor);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(mmap_reader_open(&reader, path)));
+    (void) unlink(path);
+    // When
+    const RESULT(slice, io_error) line1 = mmap_reader_next_line(&reader);
+    const RESULT(slice, io_error) line2 = mmap_reader_next_line(&reader);
+    const RESULT(slice, io_error) line3 = mmap_reader_next_line(&reader);
+    const RESULT(slice, io_error) line4 = mmap_reader_next_line(&reader);
+    // Then
+    TEST_ASSERT_INT_EQUALS((int) mmap_reader_size(&reader), 13);
+    TEST_ASSERT_INT_EQUALS((int) SLICE_LENGTH(RESULT_USE_SUCCESS(line1)), 3);
+    TEST_ASSERT(memcmp(SLICE_DATA(RESULT_USE_SUCCESS(line1)), "Rex", 3) == 0);
+    TEST_ASSERT_INT_EQUALS((int) SLICE_LENGTH(RESULT_USE_SUCCESS(line2)), 0);
+    TEST_ASSERT_INT_EQUALS((int) SLICE_LENGTH(RESULT_USE_SUCCESS(line3)), 8);
+    TEST_ASSERT(memcmp(SLICE_DATA(RESULT_USE_SUCCESS(line3)), "Garfield", 8) == 0);
+    TEST_ASSERT_TRUE(strview_equals(RESULT_USE_SUCCESS(line3), "Garfield"));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(line4), ENODATA);
+    mmap_reader_close(&reader);
+    TEST_PASS;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <result_mmap.h>
+#include "test.h"
+
+/**
+ * Tests `mmap_reader_next_record`.
+ */
+int main() {
+    // Given
+    char path[] = "/tmp/result_mmap_XXXXXX";
+    const int descriptor = mkstemp(path);
+    const char text[] = "0001Rex 0002Tom 0003";
+    struct mmap_reader reader;
+    TEST_ASSERT(descriptor != -1);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(io_write(descriptor, text, sizeof(text) - 1)));
+    (void) close(descriptor);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(mmap_reader_open(&reader, path)));
+    (void) unlink(path);
+    // When
+    const RESULT(slice, io_error) record1 = mmap_reader_next_record(&reader, 8);
+    const RESULT(slice, io_error) record2 = mmap_reader_next_record(&reader, 8);
+    const RESULT(slice, io_error) record3 = mmap_reader_next_record(&reader, 8);
+    const RESULT(slice, io_error) record4 = mmap_reader_next_record(&reader, 4);
+    const RESULT(slice, io_error) record5 = mmap_reader_next_record(&reader, 4);
+    const RESULT(slice, io_error) record6 = mmap_reader_next_record(&reader, 0);
+    // Then
+    TEST_ASSERT(memcmp(SLICE_DATA(RESULT_USE_SUCCESS(record1)), "0001Rex ", 8) == 0);
+    TEST_ASSERT(memcmp(SLICE_DATA(RESULT_USE_SUCCESS(record2)), "0002Tom ", 8) == 0);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(record3), ERANGE);
+    TEST_ASSERT(memcmp(SLICE_DATA(RESULT_USE_SUCCESS(record4)), "0003", 4) == 0);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(record5), ENODATA);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(record6), EINVAL);
+    mmap_reader_close(&reader);
+    TEST_PASS;
+}
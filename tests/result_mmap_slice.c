@@ -0,0 +1,52 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <stdlib.h>
+#include <result_mmap.h>
+#include "test.h"
+
+/**
+ * Tests `mmap_reader_slice`.
+ */
+int main() {
+    // Given
+    char path[] = "/tmp/result_mmap_XXXXXX";
+    const int descriptor = mkstemp(path);
+    const char text[] = "Hello, world!";
+    struct mmap_reader reader;
+    struct mmap_reader missing;
+    TEST_ASSERT(descriptor != -1);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(io_write(descriptor, text, sizeof(text) - 1)));
+    (void) close(descriptor);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(mmap_reader_open(&reader, path)));
+    (void) unlink(path);
+    // When
+    const RESULT(slice, io_error) slice1 = mmap_reader_slice(&reader, 7, 6);
+    const RESULT(slice, io_error) slice2 = mmap_reader_slice(&reader, 13, 0);
+    const RESULT(slice, io_error) slice3 = mmap_reader_slice(&reader, 7, 7);
+    const RESULT(slice, io_error) slice4 = mmap_reader_slice(&reader, 14, 0);
+    const RESULT(slice, io_error) slice5 = mmap_reader_slice(&reader, 1, SIZE_MAX);
+    const RESULT_VOID(io_error) opened = mmap_reader_open(&missing, path);
+    // Then
+    TEST_ASSERT(memcmp(SLICE_DATA(RESULT_USE_SUCCESS(slice1)), "world!", 6) == 0);
+    TEST_ASSERT_INT_EQUALS((int) SLICE_LENGTH(RESULT_USE_SUCCESS(slice2)), 0);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(slice3), ERANGE);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(slice4), ERANGE);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(slice5), ERANGE);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(opened), ENOENT);
+    mmap_reader_close(&reader);
+    TEST_PASS;
+}
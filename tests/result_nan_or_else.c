@@ -0,0 +1,36 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+RESULT_STRUCT_NAN(char);
+
+/**
+ * Tests `RESULT_NAN_OR_ELSE`.
+ */
+int main() {
+    // Given
+    const RESULT_NAN(char) success = RESULT_NAN_SUCCESS(1.5);
+    const RESULT_NAN(char) failure = RESULT_NAN_FAILURE('F');
+    // When
+    const double success_or_else = RESULT_NAN_OR_ELSE(success, -1.0);
+    const double failure_or_else = RESULT_NAN_OR_ELSE(failure, -1.0);
+    // Then
+    TEST_ASSERT(success_or_else == 1.5);
+    TEST_ASSERT(failure_or_else == -1.0);
+    TEST_PASS;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+RESULT_STRUCT_PACKED64(int, char);
+
+/**
+ * Tests `RESULT_PACKED64_LOAD` and `RESULT_PACKED64_STORE`.
+ */
+int main() {
+    // Given
+    RESULT(int, char) shared = RESULT_SUCCESS(1);
+    const RESULT(int, char) failure = RESULT_FAILURE('x');
+    // When
+    RESULT_PACKED64_STORE(&shared, failure);
+    const RESULT(int, char) result = RESULT_PACKED64_LOAD(&shared);
+    // Then
+    TEST_ASSERT(RESULT_HAS_FAILURE(result));
+    TEST_ASSERT_CHAR_EQUALS(RESULT_USE_FAILURE(result), 'x');
+    TEST_PASS;
+}
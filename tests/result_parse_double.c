@@ -0,0 +1,44 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result_parse.h>
+#include "test.h"
+
+/**
+ * Tests `parse_double`.
+ */
+int main() {
+    // Given
+    const char *digits = "-1234.5678";
+    // When
+    const RESULT(double, parse_error) parsed = parse_double(digits);
+    // Then
+    TEST_ASSERT(RESULT_USE_SUCCESS(parsed) == -1234.5678);
+    TEST_ASSERT(RESULT_USE_SUCCESS(parse_double("0.1")) == 0.1);
+    TEST_ASSERT(RESULT_USE_SUCCESS(parse_double(".5")) == 0.5);
+    TEST_ASSERT(RESULT_USE_SUCCESS(parse_double("5.")) == 5.0);
+    TEST_ASSERT(RESULT_USE_SUCCESS(parse_double("2.5e-3")) == 2.5e-3);
+    TEST_ASSERT(RESULT_USE_SUCCESS(parse_double("1E22")) == 1e22);
+    TEST_ASSERT(RESULT_USE_SUCCESS(parse_double("1.7976931348623157e308")) == 1.7976931348623157e308);
+    TEST_ASSERT(RESULT_USE_SUCCESS(parse_double("3.14159265358979323846264338327950288")) == 3.14159265358979323846264338327950288);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_double("")), PARSE_ERROR_EMPTY);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_double(".")), PARSE_ERROR_INVALID);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_double("inf")), PARSE_ERROR_INVALID);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_double("1e999")), PARSE_ERROR_OVERFLOW);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_double("1e")), PARSE_ERROR_TRAILING);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_double("1.5x")), PARSE_ERROR_TRAILING);
+    TEST_PASS;
+}
@@ -0,0 +1,42 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result_parse.h>
+#include "test.h"
+
+/**
+ * Tests `parse_int`.
+ */
+int main() {
+    // Given
+    const char *digits = "1234567890";
+    // When
+    const RESULT(int, parse_error) parsed = parse_int(digits);
+    // Then
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(parsed), 1234567890);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(parse_int("0")), 0);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(parse_int("+42")), 42);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(parse_int("-2147483648")), INT_MIN);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(parse_int("0000000002147483647")), INT_MAX);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int("")), PARSE_ERROR_EMPTY);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int("-")), PARSE_ERROR_INVALID);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int(" 1")), PARSE_ERROR_INVALID);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int("2147483648")), PARSE_ERROR_OVERFLOW);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int("99999999999999999999")), PARSE_ERROR_OVERFLOW);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int("12345678x")), PARSE_ERROR_TRAILING);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int("1 ")), PARSE_ERROR_TRAILING);
+    TEST_PASS;
+}
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result_parse.h>
+#include "test.h"
+
+/**
+ * Tests `parse_int64`.
+ */
+int main() {
+    // Given
+    const char *digits = "-9223372036854775808";
+    // When
+    const RESULT(int64_t, parse_error) parsed = parse_int64(digits);
+    // Then
+    TEST_ASSERT(RESULT_USE_SUCCESS(parsed) == INT64_MIN);
+    TEST_ASSERT(RESULT_USE_SUCCESS(parse_int64("9223372036854775807")) == INT64_MAX);
+    TEST_ASSERT(RESULT_USE_SUCCESS(parse_int64("1234567812345678")) == 1234567812345678);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int64("")), PARSE_ERROR_EMPTY);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int64("x1")), PARSE_ERROR_INVALID);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int64("9223372036854775808")), PARSE_ERROR_OVERFLOW);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int64("18446744073709551616")), PARSE_ERROR_OVERFLOW);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(parse_int64("1234567812345678.")), PARSE_ERROR_TRAILING);
+    TEST_PASS;
+}
@@ -0,0 +1,47 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+RESULT_STRUCT(int, char);
+
+static const RESULT(int, char) table[] = {
+    RESULT_STATIC_FAILURE('A'),
+    RESULT_STATIC_FAILURE('B')
+};
+
+/**
+ * Tests `RESULT_STATIC_FAILURE`.
+ */
+int main() {
+    // Given
+    const RESULT(int, char) result = table[1];
+    // Then
+    TEST_ASSERT_TRUE(result._failed);
+    TEST_ASSERT_CHAR_EQUALS(result._value._failure, 'B');
+#ifndef NDEBUG
+    TEST_ASSERT_NULL(result._debug._func);
+    TEST_ASSERT_NULL(result._debug._file);
+    TEST_ASSERT_INT_EQUALS(result._debug._line, 24);
+#endif
+#if __STDC_VERSION__ >= 202311L
+    constexpr RESULT(int, char) constant = RESULT_STATIC_FAILURE('C');
+    TEST_ASSERT_TRUE(constant._failed);
+    TEST_ASSERT_CHAR_EQUALS(constant._value._failure, 'C');
+#endif
+    TEST_PASS;
+}
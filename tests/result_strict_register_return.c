@@ -0,0 +1,43 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#define RESULT_STRICT_REGISTER_RETURN
+#define RESULT_DEBUG_CALLSITES
+#include <result.h>
+#include "test.h"
+
+RESULT_STRUCT(char, char);
+
+RESULT_ASSERT_REGISTER_RETURN(RESULT(char, char));
+
+static RESULT(char, char) parse(char value) {
+    RESULT(char, char) result = RESULT_FAILURE(value);
+    return result;
+}
+
+/**
+ * Tests `RESULT_ASSERT_REGISTER_RETURN` in strict mode.
+ */
+int main() {
+    // Given
+    const char value = 'x';
+    // When
+    const RESULT(char, char) result = parse(value);
+    // Then
+    TEST_ASSERT_CHAR_EQUALS(RESULT_USE_FAILURE(result), 'x');
+    TEST_ASSERT(sizeof(result) <= RESULT_REGISTER_RETURN_SIZE);
+    TEST_PASS;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <result_strview.h>
+#include "test.h"
+
+/**
+ * Tests `strview_parse_int`, `strview_parse_int64` and `strview_parse_double`.
+ */
+int main() {
+    // Given
+    const char *text = "12, -9000000000000 ,2.5e3";
+    strview rest = strview_of(text);
+    // When
+    const RESULT(strview, parse_error) first = strview_split(&rest, ',');
+    const RESULT(strview, parse_error) second = strview_split(&rest, ',');
+    const RESULT(strview, parse_error) third = strview_split(&rest, ',');
+    const RESULT(strview, parse_error) trimmed = RESULT_MAP_SUCCESS(second, strview_trim, RESULT(strview, parse_error));
+    const RESULT(int, parse_error) number = RESULT_FLAT_MAP_SUCCESS(first, strview_parse_int);
+    const RESULT(int64_t, parse_error) big = RESULT_FLAT_MAP_SUCCESS(trimmed, strview_parse_int64);
+    const RESULT(double, parse_error) real = RESULT_FLAT_MAP_SUCCESS(third, strview_parse_double);
+    // Then
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(number), 12);
+    TEST_ASSERT(RESULT_USE_SUCCESS(big) == -9000000000000);
+    TEST_ASSERT(RESULT_USE_SUCCESS(real) == 2.5e3);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(strview_parse_int(strview_from("123", 2))), 12);
+    TEST_ASSERT(RESULT_USE_SUCCESS(strview_parse_double(strview_from("1.25e2", 4))) == 1.25);
+    TEST_ASSERT(RESULT_USE_SUCCESS(strview_parse_double(strview_from("3.14159265358979323846264338327950288xyz", 37))) == 3.14159265358979323846264338327950288);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(strview_parse_int(strview_from("", 0))), PARSE_ERROR_EMPTY);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(strview_parse_int(RESULT_USE_SUCCESS(second))), PARSE_ERROR_INVALID);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(strview_parse_double(strview_from("1.5x", 4))), PARSE_ERROR_TRAILING);
+    TEST_PASS;
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <result_strview.h>
+#include "test.h"
+
+/**
+ * Tests `strview_split`.
+ */
+int main() {
+    // Given
+    const char text[] = "alpha,beta,,gamma";
+    strview rest = strview_from(text, sizeof(text) - 1);
+    // When
+    const RESULT(strview, parse_error) first = strview_split(&rest, ',');
+    const RESULT(strview, parse_error) second = strview_split(&rest, ',');
+    const RESULT(strview, parse_error) third = strview_split(&rest, ',');
+    const RESULT(strview, parse_error) fourth = strview_split(&rest, ',');
+    const RESULT(strview, parse_error) fifth = strview_split(&rest, ',');
+    // Then
+    TEST_ASSERT_TRUE(strview_equals(RESULT_USE_SUCCESS(first), "alpha"));
+    TEST_ASSERT_TRUE(strview_equals(RESULT_USE_SUCCESS(second), "beta"));
+    TEST_ASSERT_TRUE(strview_equals(RESULT_USE_SUCCESS(third), ""));
+    TEST_ASSERT_TRUE(strview_equals(RESULT_USE_SUCCESS(fourth), "gamma"));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(fifth), PARSE_ERROR_EMPTY);
+    TEST_ASSERT_TRUE(strview_equals(rest, ""));
+    TEST_ASSERT_FALSE(strview_equals(rest, "gamma"));
+    TEST_ASSERT(STRVIEW_DATA(RESULT_USE_SUCCESS(first)) == text);
+    TEST_ASSERT(STRVIEW_LENGTH(RESULT_USE_SUCCESS(fourth)) == 5);
+    TEST_PASS;
+}
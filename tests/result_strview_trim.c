@@ -0,0 +1,41 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <result_strview.h>
+#include "test.h"
+
+/**
+ * Tests `strview_trim`.
+ */
+int main() {
+    // Given
+    const strview padded = strview_of(" \t value \r\n");
+    const strview blank = strview_of(" \t\r\n");
+    const strview nulls = strview_from((const char []) {'\0', 'a', 'b', '\0'}, 4);
+    const RESULT(strview, parse_error) result = RESULT_SUCCESS(padded);
+    // When
+    const strview trimmed = strview_trim(padded);
+    const RESULT(strview, parse_error) mapped = RESULT_MAP_SUCCESS(result, strview_trim, RESULT(strview, parse_error));
+    // Then
+    TEST_ASSERT_TRUE(strview_equals(trimmed, "value"));
+    TEST_ASSERT_TRUE(strview_equals(RESULT_USE_SUCCESS(mapped), "value"));
+    TEST_ASSERT(STRVIEW_LENGTH(strview_trim(blank)) == 0);
+    TEST_ASSERT_FALSE(strview_equals(trimmed, "val"));
+    TEST_ASSERT_FALSE(strview_equals(trimmed, "values"));
+    TEST_ASSERT(STRVIEW_LENGTH(strview_trim(nulls)) == 4);
+    TEST_ASSERT_FALSE(strview_equals(strview_from("a\0", 2), "a"));
+    TEST_ASSERT_FALSE(strview_equals(strview_from("a", 1), "ab"));
+    TEST_PASS;
+}
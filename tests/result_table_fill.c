@@ -0,0 +1,49 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+RESULT_STRUCT(int, text);
+
+static RESULT(int, text) square_or_fail(int key) {
+    if (key % 2 == 0) {
+        return (RESULT(int, text)) RESULT_SUCCESS(key * key);
+    }
+    return (RESULT(int, text)) RESULT_FAILURE("Odd");
+}
+
+/**
+ * Tests `RESULT_TABLE_FILL`.
+ */
+int main() {
+    // Given
+    RESULT(int, text) table[4];
+    // When
+    RESULT_TABLE_FILL(table, square_or_fail);
+    // Then
+    TEST_ASSERT(RESULT_HAS_SUCCESS(table[0]));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(table[0]), 0);
+    TEST_ASSERT(RESULT_HAS_FAILURE(table[1]));
+    TEST_ASSERT_STR_EQUALS(RESULT_USE_FAILURE(table[1]), "Odd");
+    TEST_ASSERT(RESULT_HAS_SUCCESS(table[2]));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(table[2]), 4);
+    TEST_ASSERT(RESULT_HAS_FAILURE(table[3]));
+    TEST_ASSERT_STR_EQUALS(RESULT_USE_FAILURE(table[3]), "Odd");
+    TEST_PASS;
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+RESULT_STRUCT(int, text);
+
+static const RESULT(int, text) table[] = {
+    RESULT_STATIC_SUCCESS(100),
+    RESULT_STATIC_SUCCESS(200),
+    RESULT_STATIC_FAILURE("Two")
+};
+
+static RESULT(int, text) fallback(int key) {
+    return (RESULT(int, text)) RESULT_SUCCESS(-key);
+}
+
+/**
+ * Tests `RESULT_TABLE_GET`.
+ */
+int main() {
+    // When
+    const RESULT(int, text) first = RESULT_TABLE_GET(table, 0, fallback);
+    const RESULT(int, text) last = RESULT_TABLE_GET(table, 2, fallback);
+    const RESULT(int, text) above = RESULT_TABLE_GET(table, 3, fallback);
+    const RESULT(int, text) below = RESULT_TABLE_GET(table, -1, fallback);
+    // Then
+    TEST_ASSERT(RESULT_HAS_SUCCESS(first));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(first), 100);
+    TEST_ASSERT(RESULT_HAS_FAILURE(last));
+    TEST_ASSERT_STR_EQUALS(RESULT_USE_FAILURE(last), "Two");
+    TEST_ASSERT(RESULT_HAS_SUCCESS(above));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(above), -3);
+    TEST_ASSERT(RESULT_HAS_SUCCESS(below));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(below), 1);
+    TEST_PASS;
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result_tls.h>
+#include "test.h"
+
+typedef struct { int code; char message[100]; } detailed_error;
+
+RESULT_STRUCT_TLS(int, detailed_error);
+
+RESULT_STRUCT_TLS(int, long);
+
+static RESULT_TLS(int, detailed_error) fail(int code) {
+    const detailed_error error = {.code = code, .message = "Detailed message"};
+    return (RESULT_TLS(int, detailed_error)) RESULT_TLS_FAILURE(RESULT_TLS(int, detailed_error), error);
+}
+
+/**
+ * Tests `RESULT_TLS_FAILURE` and `RESULT_TLS_USE_FAILURE`.
+ */
+int main() {
+    // Given
+    const RESULT_TLS(int, detailed_error) result = fail(42);
+    // When
+    const detailed_error error = RESULT_TLS_USE_FAILURE(result);
+    const RESULT_TLS(int, long) wide = RESULT_TLS_FAILURE(RESULT_TLS(int, long), -1L);
+    const long first = RESULT_TLS_USE_FAILURE(wide);
+    const RESULT_TLS(int, long) narrow = RESULT_TLS_FAILURE(RESULT_TLS(int, long), 5);
+    const long second = RESULT_TLS_USE_FAILURE(narrow);
+    // Then
+    TEST_ASSERT(sizeof(result) < sizeof(detailed_error));
+    TEST_ASSERT(RESULT_HAS_FAILURE(result));
+    TEST_ASSERT_INT_EQUALS(RESULT_OR_ELSE(result, -1), -1);
+    TEST_ASSERT_INT_EQUALS(error.code, 42);
+    TEST_ASSERT_STR_EQUALS(error.message, "Detailed message");
+    TEST_ASSERT(first == -1);
+    TEST_ASSERT(second == 5);
+    TEST_PASS;
+}
@@ -0,0 +1,34 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result_tls.h>
+#include "test.h"
+
+RESULT_STRUCT_TLS(int, double);
+
+/**
+ * Tests thread-local `RESULT_SUCCESS`.
+ */
+int main() {
+    // Given
+    const RESULT_TLS(int, double) result = RESULT_SUCCESS(123);
+    // Then
+    TEST_ASSERT(RESULT_HAS_SUCCESS(result));
+    TEST_ASSERT_FALSE(RESULT_HAS_FAILURE(result));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(result), 123);
+    TEST_ASSERT_INT_EQUALS(RESULT_OR_ELSE(result, 0), 123);
+    TEST_PASS;
+}
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+RESULT_STRUCT_VOID(char);
+
+static char last_failure = 0;
+
+static void set_last_failure(char failure) {
+    last_failure = failure;
+}
+
+/**
+ * Tests `RESULT_FAILURE` with results with no success value.
+ */
+int main() {
+    // Given
+    const RESULT_VOID(char) result = RESULT_FAILURE('A');
+    // When
+    RESULT_IF_FAILURE(result, set_last_failure);
+    // Then
+    TEST_ASSERT(RESULT_HAS_FAILURE(result));
+    TEST_ASSERT_CHAR_EQUALS(RESULT_USE_FAILURE(result), 'A');
+    TEST_ASSERT_CHAR_EQUALS(*RESULT_GET_FAILURE(result), 'A');
+    TEST_ASSERT_CHAR_EQUALS(last_failure, 'A');
+#ifdef NDEBUG
+    TEST_ASSERT(sizeof(result) <= 2 * sizeof(char));
+#endif
+    TEST_PASS;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <result.h>
+#include "test.h"
+
+typedef const char *text;
+
+RESULT_STRUCT_VOID(char);
+
+RESULT_STRUCT_VOID(text);
+
+#define first_char(s) \
+    *s
+
+/**
+ * Tests `RESULT_VOID_MAP_FAILURE`.
+ */
+int main() {
+    // Given
+    const RESULT_VOID(text) success = RESULT_VOID_SUCCESS();
+    const RESULT_VOID(text) failure = RESULT_FAILURE("Failure");
+    // When
+    const RESULT_VOID(char) mapped_success = RESULT_VOID_MAP_FAILURE(success, first_char, RESULT_VOID(char));
+    const RESULT_VOID(char) mapped_failure = RESULT_VOID_MAP_FAILURE(failure, first_char, RESULT_VOID(char));
+    // Then
+    TEST_ASSERT(RESULT_HAS_SUCCESS(mapped_success));
+    TEST_ASSERT(RESULT_HAS_FAILURE(mapped_failure));
+    TEST_ASSERT_CHAR_EQUALS(RESULT_USE_FAILURE(mapped_failure), 'F');
+    TEST_PASS;
+}
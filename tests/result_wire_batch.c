@@ -0,0 +1,87 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <result_wire.h>
+#include "test.h"
+
+typedef struct message {
+    const char *text;
+    size_t length;
+} message;
+
+typedef enum message_error {
+    MESSAGE_EMPTY = 1,
+    MESSAGE_REJECTED = 300
+} message_error;
+
+RESULT_STRUCT(message, message_error);
+
+/* Writes the length of the text as a varint, followed by the text */
+static RESULT_VOID(wire_error) encode_message(struct wire_writer *writer, const message *value) {
+    const RESULT_VOID(wire_error) length = wire_write_varint(writer, value->length);
+    return RESULT_HAS_FAILURE(length) ? length : wire_write_bytes(writer, value->text, value->length);
+}
+
+/* Reads the length of the text, and points the message into the buffer */
+static RESULT_VOID(wire_error) decode_message(struct wire_reader *reader, message *value) {
+    const RESULT(uint64_t, wire_error) length = wire_read_varint(reader);
+    if (RESULT_HAS_FAILURE(length)) {
+        return (RESULT_VOID(wire_error)) RESULT_FAILURE(RESULT_USE_FAILURE(length));
+    }
+    const RESULT(wire_pointer, wire_error) text = wire_read_bytes(reader, RESULT_USE_SUCCESS(length));
+    if (RESULT_HAS_FAILURE(text)) {
+        return (RESULT_VOID(wire_error)) RESULT_FAILURE(RESULT_USE_FAILURE(text));
+    }
+    value->text = RESULT_USE_SUCCESS(text);
+    value->length = RESULT_USE_SUCCESS(length);
+    return (RESULT_VOID(wire_error)) RESULT_VOID_SUCCESS();
+}
+
+RESULT_WIRE_CODEC(message, message_error, encode_message, decode_message);
+
+/**
+ * Tests `RESULT_WIRE_BATCH_ENCODER` and `RESULT_WIRE_BATCH_DECODER`.
+ */
+int main() {
+    // Given
+    const RESULT(message, message_error) results[3] = {
+        RESULT_SUCCESS(((message) {.text = "hello", .length = 5})),
+        RESULT_FAILURE(MESSAGE_REJECTED),
+        RESULT_SUCCESS(((message) {.text = "", .length = 0}))
+    };
+    uint8_t buffer[64];
+    struct wire_writer writer = wire_writer_init(buffer, sizeof(buffer));
+    RESULT(message, message_error) decoded[3];
+    // When
+    const RESULT_VOID(wire_error) encoded = RESULT_WIRE_BATCH_ENCODER(message, message_error)(&writer, results, 3);
+    struct wire_reader reader = wire_reader_init(buffer, wire_writer_length(&writer));
+    const RESULT(size_t, wire_error) count = RESULT_WIRE_BATCH_DECODER(message, message_error)(&reader, decoded, 3);
+    // Then
+    TEST_ASSERT_TRUE(RESULT_HAS_SUCCESS(encoded));
+    TEST_ASSERT(wire_writer_length(&writer) == 1 + 7 + 3 + 2);
+    TEST_ASSERT(RESULT_USE_SUCCESS(count) == 3);
+    TEST_ASSERT(RESULT_USE_SUCCESS(decoded[0]).text == (const char *) buffer + 3);
+    TEST_ASSERT(RESULT_USE_SUCCESS(decoded[0]).length == 5);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(decoded[1]), MESSAGE_REJECTED);
+    TEST_ASSERT(RESULT_USE_SUCCESS(decoded[2]).length == 0);
+    reader = wire_reader_init(buffer, wire_writer_length(&writer));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(RESULT_WIRE_BATCH_DECODER(message, message_error)(&reader, decoded, 2)), WIRE_ERROR_OVERFLOW);
+    reader = wire_reader_init(buffer, wire_writer_length(&writer) - 1);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(RESULT_WIRE_BATCH_DECODER(message, message_error)(&reader, decoded, 3)), WIRE_ERROR_TRUNCATED);
+    writer = wire_writer_init(buffer, 8);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(RESULT_WIRE_BATCH_ENCODER(message, message_error)(&writer, results, 3)), WIRE_ERROR_NO_SPACE);
+    TEST_ASSERT(wire_writer_length(&writer) == 0);
+    TEST_PASS;
+}
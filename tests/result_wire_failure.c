@@ -0,0 +1,56 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <result_wire.h>
+#include "test.h"
+
+typedef signed char small_error;
+
+RESULT_STRUCT(int, small_error);
+
+RESULT_WIRE_FIXED_CODEC(int, small_error);
+
+/**
+ * Tests that malformed or oversized input is rejected when decoding results.
+ */
+int main() {
+    // Given
+    const uint8_t invalid_tag[] = {0x02};
+    const uint8_t truncated[] = {WIRE_TAG_SUCCESS, 0x01, 0x02};
+    const uint8_t overflow[] = {WIRE_TAG_FAILURE, 0x80, 0x04};
+    const RESULT(int, small_error) success = RESULT_SUCCESS(42);
+    uint8_t buffer[4];
+    struct wire_writer writer = wire_writer_init(buffer, sizeof(buffer));
+    RESULT(int, small_error) decoded = RESULT_FAILURE(7);
+    // When
+    struct wire_reader reader1 = wire_reader_init(invalid_tag, sizeof(invalid_tag));
+    struct wire_reader reader2 = wire_reader_init(truncated, sizeof(truncated));
+    struct wire_reader reader3 = wire_reader_init(overflow, sizeof(overflow));
+    const RESULT_VOID(wire_error) read1 = RESULT_WIRE_DECODER(int, small_error)(&reader1, &decoded);
+    const RESULT_VOID(wire_error) read2 = RESULT_WIRE_DECODER(int, small_error)(&reader2, &decoded);
+    const RESULT_VOID(wire_error) read3 = RESULT_WIRE_DECODER(int, small_error)(&reader3, &decoded);
+    const RESULT_VOID(wire_error) written = RESULT_WIRE_ENCODER(int, small_error)(&writer, &success);
+    // Then
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(read1), WIRE_ERROR_INVALID_TAG);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(read2), WIRE_ERROR_TRUNCATED);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(read3), WIRE_ERROR_OVERFLOW);
+    TEST_ASSERT(wire_reader_remaining(&reader1) == sizeof(invalid_tag));
+    TEST_ASSERT(wire_reader_remaining(&reader2) == sizeof(truncated));
+    TEST_ASSERT(wire_reader_remaining(&reader3) == sizeof(overflow));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(decoded), 7);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(written), WIRE_ERROR_NO_SPACE);
+    TEST_ASSERT(wire_writer_length(&writer) == 0);
+    TEST_PASS;
+}
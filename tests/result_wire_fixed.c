@@ -0,0 +1,61 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <result_wire.h>
+#include "test.h"
+
+typedef struct point {
+    int x;
+    int y;
+} point;
+
+typedef int point_error;
+
+RESULT_STRUCT(point, point_error);
+
+RESULT_WIRE_FIXED_CODEC(point, point_error);
+
+/**
+ * Tests `RESULT_WIRE_FIXED_CODEC`.
+ */
+int main() {
+    // Given
+    const RESULT(point, point_error) success = RESULT_SUCCESS(((point) {.x = 3, .y = -4}));
+    const RESULT(point, point_error) failure = RESULT_FAILURE(-2);
+    uint8_t buffer[64];
+    struct wire_writer writer = wire_writer_init(buffer, sizeof(buffer));
+    // When
+    const RESULT_VOID(wire_error) encoded1 = RESULT_WIRE_ENCODER(point, point_error)(&writer, &success);
+    const RESULT_VOID(wire_error) encoded2 = RESULT_WIRE_ENCODER(point, point_error)(&writer, &failure);
+    struct wire_reader reader = wire_reader_init(buffer, wire_writer_length(&writer));
+    RESULT(point, point_error) decoded1;
+    RESULT(point, point_error) decoded2;
+    const RESULT_VOID(wire_error) read1 = RESULT_WIRE_DECODER(point, point_error)(&reader, &decoded1);
+    const RESULT_VOID(wire_error) read2 = RESULT_WIRE_DECODER(point, point_error)(&reader, &decoded2);
+    // Then
+    TEST_ASSERT_TRUE(RESULT_HAS_SUCCESS(encoded1));
+    TEST_ASSERT_TRUE(RESULT_HAS_SUCCESS(encoded2));
+    TEST_ASSERT(wire_writer_length(&writer) == 1 + sizeof(point) + 2);
+    TEST_ASSERT_INT_EQUALS(buffer[0], WIRE_TAG_SUCCESS);
+    TEST_ASSERT_INT_EQUALS(buffer[1 + sizeof(point)], WIRE_TAG_FAILURE);
+    TEST_ASSERT_INT_EQUALS(buffer[2 + sizeof(point)], 3);
+    TEST_ASSERT_TRUE(RESULT_HAS_SUCCESS(read1));
+    TEST_ASSERT_TRUE(RESULT_HAS_SUCCESS(read2));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(decoded1).x, 3);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_SUCCESS(decoded1).y, -4);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(decoded2), -2);
+    TEST_ASSERT(wire_reader_remaining(&reader) == 0);
+    TEST_PASS;
+}
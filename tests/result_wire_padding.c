@@ -0,0 +1,55 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <result_wire.h>
+#include "test.h"
+
+typedef struct tagged {
+    char tag;
+    int value;
+} tagged;
+
+typedef int tagged_error;
+
+RESULT_STRUCT(tagged, tagged_error);
+
+RESULT_WIRE_FIXED_CODEC(tagged, tagged_error);
+
+/**
+ * Tests that `RESULT_WIRE_FIXED_CODEC` does not encode padding bytes.
+ */
+int main() {
+#if !RESULT_CLEARS_PADDING
+    TEST_SKIP("Padding bytes cannot be cleared by this compiler");
+#else
+    // Given
+    RESULT(tagged, tagged_error) success = RESULT_SUCCESS(((tagged) {.tag = 'x', .value = 42}));
+    memset((char *) &RESULT_USE_SUCCESS(success) + 1, 0xFF, sizeof(int) - 1);
+    uint8_t buffer[64];
+    struct wire_writer writer = wire_writer_init(buffer, sizeof(buffer));
+    // When
+    const RESULT_VOID(wire_error) encoded = RESULT_WIRE_ENCODER(tagged, tagged_error)(&writer, &success);
+    // Then
+    TEST_ASSERT_TRUE(RESULT_HAS_SUCCESS(encoded));
+    TEST_ASSERT(wire_writer_length(&writer) == 1 + sizeof(tagged));
+    TEST_ASSERT_INT_EQUALS(buffer[1], 'x');
+    for (size_t index = 2; index < 1 + offsetof(tagged, value); index++) {
+        TEST_ASSERT_INT_EQUALS(buffer[index], 0);
+    }
+    TEST_PASS;
+#endif
+}
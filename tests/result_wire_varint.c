@@ -0,0 +1,55 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <result_wire.h>
+#include "test.h"
+
+/**
+ * Tests `wire_write_varint` and `wire_read_varint`.
+ */
+int main() {
+    // Given
+    const uint64_t values[] = {0, 1, 127, 128, 300, 16384, UINT64_MAX};
+    const size_t sizes[] = {1, 1, 1, 2, 2, 3, WIRE_VARINT_MAX_SIZE};
+    uint8_t buffer[64];
+    struct wire_writer writer = wire_writer_init(buffer, sizeof(buffer));
+    // When
+    for (size_t index = 0; index < 7; index++) {
+        const size_t length = wire_writer_length(&writer);
+        const RESULT_VOID(wire_error) written = wire_write_varint(&writer, values[index]);
+        TEST_ASSERT_TRUE(RESULT_HAS_SUCCESS(written));
+        TEST_ASSERT(wire_writer_length(&writer) - length == sizes[index]);
+    }
+    struct wire_reader reader = wire_reader_init(buffer, wire_writer_length(&writer));
+    // Then
+    TEST_ASSERT_INT_EQUALS(buffer[3], 0x80);
+    TEST_ASSERT_INT_EQUALS(buffer[4], 0x01);
+    for (size_t index = 0; index < 7; index++) {
+        const RESULT(uint64_t, wire_error) read = wire_read_varint(&reader);
+        TEST_ASSERT(RESULT_USE_SUCCESS(read) == values[index]);
+    }
+    TEST_ASSERT(wire_reader_remaining(&reader) == 0);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(wire_read_varint(&reader)), WIRE_ERROR_TRUNCATED);
+    const uint8_t truncated[] = {0x80, 0x80};
+    reader = wire_reader_init(truncated, sizeof(truncated));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(wire_read_varint(&reader)), WIRE_ERROR_TRUNCATED);
+    const uint8_t overflow[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+    reader = wire_reader_init(overflow, sizeof(overflow));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(wire_read_varint(&reader)), WIRE_ERROR_OVERFLOW);
+    writer = wire_writer_init(buffer, 1);
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_FAILURE(wire_write_varint(&writer, 128)), WIRE_ERROR_NO_SPACE);
+    TEST_ASSERT(wire_writer_length(&writer) == 0);
+    TEST_PASS;
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string.h>
+#include <result.h>
+#include "test.h"
+
+RESULT_STRUCT_CONTEXT(int);
+
+RESULT_STRUCT_CONTEXTUAL(double, int);
+
+static RESULT_ARENA(sizeof(struct result_context) * 2) arena;
+
+/**
+ * Tests `RESULT_WRAP_FAILURE`.
+ */
+int main() {
+    // Given
+    const RESULT_CONTEXTUAL(double, int) success = RESULT_SUCCESS(1.5);
+    const RESULT_CONTEXTUAL(double, int) failure = RESULT_CONTEXT_FAILURE(42);
+    // When
+    const RESULT_CONTEXTUAL(double, int) wrapped_success = RESULT_WRAP_FAILURE(arena, success, "Ignored");
+    const RESULT_CONTEXTUAL(double, int) inner = RESULT_WRAP_FAILURE(arena, failure, "Inner");
+    const RESULT_CONTEXTUAL(double, int) outer = RESULT_WRAP_FAILURE(arena, inner, "Outer");
+    const RESULT_CONTEXTUAL(double, int) exhausted = RESULT_WRAP_FAILURE(arena, outer, "Dropped");
+    // Then
+    TEST_ASSERT(RESULT_HAS_SUCCESS(wrapped_success));
+    TEST_ASSERT(RESULT_USE_SUCCESS(wrapped_success) == 1.5);
+    TEST_ASSERT(RESULT_HAS_FAILURE(failure));
+    TEST_ASSERT_NULL(RESULT_USE_CONTEXT(failure));
+    TEST_ASSERT(RESULT_HAS_FAILURE(outer));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_ROOT_FAILURE(outer), 42);
+    TEST_ASSERT_STR_EQUALS(RESULT_CONTEXT_MESSAGE(RESULT_USE_CONTEXT(outer)), "Outer");
+    TEST_ASSERT(RESULT_CONTEXT_CAUSE(RESULT_USE_CONTEXT(outer)) == RESULT_USE_CONTEXT(inner));
+    TEST_ASSERT_STR_EQUALS(RESULT_CONTEXT_MESSAGE(RESULT_USE_CONTEXT(inner)), "Inner");
+    TEST_ASSERT_NULL(RESULT_CONTEXT_CAUSE(RESULT_USE_CONTEXT(inner)));
+    TEST_ASSERT_INT_EQUALS(RESULT_USE_ROOT_FAILURE(exhausted), 42);
+    TEST_ASSERT(RESULT_USE_CONTEXT(exhausted) == RESULT_USE_CONTEXT(outer));
+#ifndef NDEBUG
+    TEST_ASSERT_INT_EQUALS(RESULT_DEBUG_LINE(outer), 33);
+#endif
+    TEST_PASS;
+}
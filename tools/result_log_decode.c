@@ -0,0 +1,48 @@
+/*
+ * Copyright 2025 Guillermo Calvo
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <result_log.h>
+#include <result_mmap.h>
+
+/**
+ * Writes the records of a failure log file as text.
+ */
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        (void) fprintf(stderr, "Usage: %s <log file>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+    struct mmap_reader reader;
+    const RESULT_VOID(io_error) opened = mmap_reader_open(&reader, argv[1]);
+    if (RESULT_HAS_FAILURE(opened)) {
+        (void) fprintf(stderr, "%s: %s\n", argv[1],
+            strerror(RESULT_USE_FAILURE(opened)));
+        return EXIT_FAILURE;
+    }
+    const size_t size = mmap_reader_size(&reader);
+    const RESULT(slice, io_error) contents = mmap_reader_slice(&reader, 0,
+        size);
+    const RESULT(size_t, io_error) decoded = result_log_decode(stdout,
+        SLICE_DATA(RESULT_USE_SUCCESS(contents)), size);
+    mmap_reader_close(&reader);
+    if (RESULT_HAS_FAILURE(decoded)) {
+        (void) fprintf(stderr, "%s: not a failure log\n", argv[1]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}